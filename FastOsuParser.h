@@ -21,17 +21,354 @@ freely, subject to the following restrictions:
 #ifndef _FAST_OSU_PARSER_H
 #define _FAST_OSU_PARSER_H
 
+#if defined(__linux__) && !defined(_GNU_SOURCE) && !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE // (POSIX & BSD extras like mmap flags, pread, openat & st_mtim that strict -std=c11 hides, include this header before any other for it to take effect)
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define _FASTOSUPARSER_X86 // SSE2/AVX2 kernels, picked at runtime
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define _FASTOSUPARSER_IO_URING // (FastOsuParser__BatchOptions.b_io_uring)
+#include <linux/io_uring.h>
+#include <linux/stat.h>
+#include <sys/syscall.h>
+#include <errno.h>
+#endif
+#endif
+
+#if !defined(FASTOSUPARSER_NO_THREADS) // (define to drop the thread pool & its pthread dependency)
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+#endif
+
+#if defined(FASTOSUPARSER_PROFILE) // (define to record where parsing time goes, see FastOsuParser__Profile)
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+// Put before every function below: nothing in C, where the header is included by the one translation unit that calls it (or define it as "static inline"
+// before including it, to include it in several), & "inline" in C++, so that every translation unit including FastOsuParser.hpp shares one definition
+#if !defined(FASTOSUPARSER_DEF)
+#if defined(__cplusplus)
+#define FASTOSUPARSER_DEF inline
+#else
+#define FASTOSUPARSER_DEF
+#endif
+#endif
+
+
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+
+#if defined(_WIN32)
+typedef HANDLE _FastOsuParser__Thread;
+typedef SRWLOCK _FastOsuParser__Mutex;
+#else
+typedef pthread_t _FastOsuParser__Thread;
+typedef pthread_mutex_t _FastOsuParser__Mutex;
+#endif
+
+FASTOSUPARSER_DEF void _FastOsuParser__MutexInit(_FastOsuParser__Mutex* mutex) {
+#if defined(_WIN32)
+        InitializeSRWLock(mutex);
+#else
+        pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__MutexLock(_FastOsuParser__Mutex* mutex) {
+#if defined(_WIN32)
+        AcquireSRWLockExclusive(mutex);
+#else
+        pthread_mutex_lock(mutex);
+#endif
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__MutexUnlock(_FastOsuParser__Mutex* mutex) {
+#if defined(_WIN32)
+        ReleaseSRWLockExclusive(mutex);
+#else
+        pthread_mutex_unlock(mutex);
+#endif
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__MutexDestroy(_FastOsuParser__Mutex* mutex) {
+#if defined(_WIN32)
+        (void)mutex;
+#else
+        pthread_mutex_destroy(mutex);
+#endif
+}
+
+FASTOSUPARSER_DEF size_t _FastOsuParser__CpuCount() {
+#if defined(_WIN32)
+        SYSTEM_INFO system_info;
+        GetSystemInfo(&system_info);
+        return system_info.dwNumberOfProcessors;
+#else
+        long cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
+        return (cpu_count < 1) ? 1 : cpu_count;
+#endif
+}
+
+#endif
+
+
+
+typedef struct {
+        void* (*alloc)(size_t size, void* user);
+        void (*free)(void* memory, void* user); // Can be NULL if memory from "alloc" is owned elsewhere (f.ex. a caller arena)
+        void* user;
+} FastOsuParser__Allocator;
+
+
+
+// Optional fields, only decoded & laid out when their macro is defined before including the header:
+// FASTOSUPARSER_HIT_SOUNDS: "hitSound", "hitSample" & sliders' "edgeSounds"/"edgeSets" of hit objects
+// FASTOSUPARSER_TIMING_POINT_SAMPLES: "sampleSet", "sampleIndex", "volume" & "effects" of timing points
+// FASTOSUPARSER_HOLD_NOTES: "endTime" of osu!mania hold notes
+
+typedef struct {
+        int time;
+#if defined(FASTOSUPARSER_TIMING_POINT_SAMPLES)
+        int sample_index; // 0 = osu!'s default samples
+#endif
+        double beat_length;
+        int meter;
+        char b_uninherited;
+#if defined(FASTOSUPARSER_TIMING_POINT_SAMPLES)
+        unsigned char sample_set; // 0 = beatmap default, 1 = normal, 2 = soft, 3 = drum
+        unsigned char volume; // (%)
+        unsigned char effects; // Bits: 0 = kiai time, 3 = omit first barline
+#endif
+} FastOsuParser__TimingPoint;
+
+typedef struct {
+        int x;
+        int y;
+} FastOsuParser__CurvePoint;
+
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+// Sound of a slider's head, repeats or tail (in "edgeSounds" & "edgeSets" order, see FastOsuParser__EdgeSounds())
+// (as big as a curve point, they're stored in the same array)
+typedef struct {
+        unsigned char hit_sound; // (like FastOsuParser__HitObject)
+        unsigned char normal_set;
+        unsigned char addition_set;
+        char _reserved[sizeof(FastOsuParser__CurvePoint) - 3];
+} FastOsuParser__EdgeSound;
+#endif
+
+typedef struct {
+        int x;
+        int y;
+        int time;
+        int type;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        unsigned char hit_sound; // Bits: 0 = normal, 1 = whistle, 2 = finish, 3 = clap
+        unsigned char normal_set; // "hitSample" (without its file name): 0 = the timing point's, 1 = normal, 2 = soft, 3 = drum
+        unsigned char addition_set; // (same)
+        unsigned char volume; // (%, 0 = the timing point's)
+        int sample_index; // (0 = the timing point's)
+#endif
+        union {
+                // slider
+                struct {
+                        char curve_type; // "B", "C", "L", or "P"
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        int edge_sounds_count; // (0 if the line has no "edgeSounds")
+#endif
+                        FastOsuParser__CurvePoint* curve_points;
+                        size_t curve_points_count;
+                        int slides;
+                        double length;
+                };
+                
+                // spinner (and osu!mania hold note with FASTOSUPARSER_HOLD_NOTES)
+                int end_time;
+        } object_params;
+} FastOsuParser__HitObject;
+
+// Side tables of columnar hit objects (FastOsuParser__PARSE_COLUMNS)
+typedef struct {
+        size_t object; // Index into the hit object columns
+        char curve_type; // "B", "C", "L", or "P"
+        FastOsuParser__CurvePoint* curve_points;
+        size_t curve_points_count;
+        int slides;
+        double length;
+} FastOsuParser__Slider;
+
+typedef struct {
+        size_t object; // Index into the hit object columns
+        int end_time;
+} FastOsuParser__Spinner;
+
+typedef struct {
+        float x;
+        float y;
+} FastOsuParser__PathPoint;
+
+// Timing in effect at some point of a beatmap (FastOsuParser__TimingAt())
+typedef struct {
+        double beat_length; // Of the uninherited timing point in effect (ms per beat)
+        double slider_velocity; // Of the inherited timing point in effect (1 if none since the last uninherited one)
+        int meter;
+} FastOsuParser__Timing;
+
+// Timing of a hit object (FastOsuParser__PARSE_TIMING_INDEX)
+typedef struct {
+        double beat_length; // (like FastOsuParser__Timing)
+        double slider_velocity;
+        double end_time; // Sliders: after all of their slides, spinners: "end_time", circles: "time"
+        int ticks; // Slider ticks over all of its slides (0 for circles & spinners)
+} FastOsuParser__HitObjectTiming;
+
+// Flattened slider path (FastOsuParser__ComputeSliderPaths())
+typedef struct {
+        size_t object; // Index of the slider's hit object
+        FastOsuParser__PathPoint* points; // From the slider's head, cut/extended to its "length" (at least 1)
+        float* lengths; // Distance along the path at each point
+        size_t points_count;
+} FastOsuParser__SliderPath;
 
+// Derived statistics (FastOsuParser__PARSE_STATS)
+typedef struct {
+        int max_combo; // (osu!standard rules: 1 per circle/spinner, 1 + ticks + slides per slider)
+        int circles_count;
+        int sliders_count;
+        int spinners_count;
+        int breaks_count; // From [Events]
+        double breaks_length; // (ms)
+        double first_object_time; // (ms)
+        double last_object_end_time; // (ms)
+        double total_length; // From the first hit object to the end of the last one (ms)
+        double drain_length; // "total_length" without the breaks (ms)
+        double min_bpm; // Of the uninherited timing points
+        double max_bpm;
+        double dominant_bpm; // The one lasting the longest until the end of the last hit object
+} FastOsuParser__Stats;
+
+
+
+// What to parse ("parse_flags")
+enum {
+        FastOsuParser__PARSE_GENERAL = 1 << 0,
+        FastOsuParser__PARSE_METADATA = 1 << 1,
+        FastOsuParser__PARSE_DIFFICULTY = 1 << 2,
+        FastOsuParser__PARSE_TIMING_POINTS = 1 << 3,
+        FastOsuParser__PARSE_HIT_OBJECTS = 1 << 4,
+        FastOsuParser__PARSE_CURVE_POINTS = 1 << 5, // (of sliders in [HitObjects])
+
+        FastOsuParser__PARSE_SECTIONS = (1 << 5) - 1,
+        FastOsuParser__PARSE_ALL = (1 << 6) - 1,
+
+        FastOsuParser__PARSE_COLUMNS = 1 << 6, // Hit objects into "hit_objects_x" & co. instead of "hit_objects" (add to the flags above)
+        FastOsuParser__PARSE_TIMING_INDEX = 1 << 7, // Also fill "timing_index" & "hit_object_timings" (add to the flags above)
+        FastOsuParser__PARSE_STATS = 1 << 8, // Also fill "stats" (add to the flags above, without FastOsuParser__PARSE_HIT_OBJECTS they're only counted, not stored)
+        FastOsuParser__PARSE_MD5 = 1 << 9, // Also fill "md5" (add to the flags above)
+        FastOsuParser__PARSE_HASH = 1 << 10, // Also fill "hash" (add to the flags above)
+        FastOsuParser__PARSE_SINGLE_THREAD = 1 << 11 // Never split a big [HitObjects] over threads (add to the flags above, FastOsuParser__ParseBatch() adds it itself when it runs on more than one)
+};
+
+// Whether sliders parsed with "flags" take room in the curve point array (for their curve points, and their edge sounds with FASTOSUPARSER_HIT_SOUNDS)
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+#define _FASTOSUPARSER_CURVE_POINTS_STORAGE(flags) 1
+#else
+#define _FASTOSUPARSER_CURVE_POINTS_STORAGE(flags) ((flags) & FastOsuParser__PARSE_CURVE_POINTS)
+#endif
+
+#if defined(FASTOSUPARSER_STRING_POOL) // (define to keep metadata strings in a shared pool instead of fixed 256-byte arrays)
+
+// A string in a FastOsuParser__StringPool, read it with FastOsuParser__String() ("size" 0 = empty/missing)
+typedef struct {
+        uint32_t offset;
+        uint32_t size;
+} FastOsuParser__StringView;
 
+// Deduplicating storage for the metadata strings of many beatmaps (FastOsuParser__StringPoolInit() it, free it with FastOsuParser__StringPoolFree())
+// Each distinct string is stored once, NUL-terminated, so a library of maps by the same few mappers/artists shares them
+// Beatmaps can be parsed into the same pool from multiple threads
+typedef struct {
+        char* data;
+        size_t size;
+        size_t capacity;
+        FastOsuParser__StringView* slots; // Open addressing by hash, "size" 0 = empty slot
+        size_t slots_mask;
+        size_t strings_count;
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__Mutex mutex;
+#endif
+} FastOsuParser__StringPool;
+
+#endif
+
+#if defined(FASTOSUPARSER_PROFILE)
+
+// Sections of FastOsuParser__Profile
+enum {
+        FastOsuParser__PROFILE_SKIPPED, // Sections that weren't requested/aren't parsed, & anything before the first one
+        FastOsuParser__PROFILE_GENERAL,
+        FastOsuParser__PROFILE_METADATA,
+        FastOsuParser__PROFILE_DIFFICULTY,
+        FastOsuParser__PROFILE_EVENTS,
+        FastOsuParser__PROFILE_TIMING_POINTS,
+        FastOsuParser__PROFILE_HIT_OBJECTS,
+        FastOsuParser__PROFILE_SECTIONS
+};
+
+// Where parsing a beatmap went (FastOsuParser__Parse()/_ParseBuffer()/_ParseRange()/_ParseBatch(), added to as they go)
+typedef struct {
+        uint64_t section_ns[FastOsuParser__PROFILE_SECTIONS];
+        uint64_t section_bytes[FastOsuParser__PROFILE_SECTIONS];
+        uint64_t io_ns; // Opening & reading the file (or mapping it: its pages are then read in as they're parsed, so that's in "section_ns")
+        uint64_t hash_ns; // FastOsuParser__PARSE_MD5/_HASH & batch deduplication
+        uint64_t count_ns; // Counting lines to size the allocation up-front
+        uint64_t finish_ns; // Timing index & stats, after the sections
+        uint64_t parse_ns; // All of parsing the buffer (all of the above but "io_ns" & "hash_ns")
+        uint64_t allocations;
+        uint64_t allocated_bytes;
+        uint64_t curve_points; // Decoded
+} FastOsuParser__Profile;
+
+#endif
 
 typedef struct {
         // [General]:
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringView audio_file_name;
+#else
         char audio_file_name[256];
         short audio_file_name_size;
+#endif
         int audio_lead_in;
         int countdown; // 0 = None, 1 = Normal, 2 = Half, 3 = Double
         float stack_leniency;
@@ -39,6 +376,16 @@ typedef struct {
         int countdown_offset;
 
         // [Metadata]:
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringView title;
+        FastOsuParser__StringView title_unicode;
+        FastOsuParser__StringView artist;
+        FastOsuParser__StringView artist_unicode;
+        FastOsuParser__StringView creator;
+        FastOsuParser__StringView version; // diff name
+        FastOsuParser__StringView source;
+        FastOsuParser__StringView tags;
+#else
         char title[256];
         size_t title_size;
         char artist[256];
@@ -47,6 +394,7 @@ typedef struct {
         size_t creator_size;
         char version[256]; // diff name
         size_t version_size;
+#endif
         int beatmap_id; // diff ID
         int beatmap_set_id; // beatmap ID
 
@@ -59,41 +407,50 @@ typedef struct {
         double slider_tick_rate;
 
         // [TimingPoints]:
-        struct {
-                int time;
-                double beat_length;
-                int meter;
-                char b_uninherited;
-        }* timing_points;
+        FastOsuParser__TimingPoint* timing_points;
         size_t timing_points_count;
 
         // [HitObjects]:
-        struct {
-                int x;
-                int y;
-                int time;
-                int type;
-                union {
-                        // slider
-                        struct {
-                                char curve_type; // "B", "C", "L", or "P"
-                                struct {
-                                        int x;
-                                        int y;
-                                }* curve_points;
-                                size_t curve_points_count;
-                                int slides;
-                                double length;
-                        };
-                        
-                        // spinner
-                        int end_time;
-                } object_params;
-        }* hit_objects;
+        FastOsuParser__HitObject* hit_objects;
         size_t hit_objects_count;
 
-        void** _total_curve_points;
-        size_t _total_curve_points_count;
+        // [HitObjects] as columns instead (FastOsuParser__PARSE_COLUMNS), each 64-byte aligned & "hit_objects_count" long:
+        int* hit_objects_x;
+        int* hit_objects_y;
+        int* hit_objects_time;
+        int* hit_objects_type;
+        int* hit_objects_params; // Index into "sliders"/"spinners" (by type), -1 for circles
+        FastOsuParser__Slider* sliders;
+        size_t sliders_count;
+        FastOsuParser__Spinner* spinners;
+        size_t spinners_count;
+
+        // Timing index (FastOsuParser__PARSE_TIMING_INDEX):
+        FastOsuParser__Timing* timing_index; // Timing in effect from each timing point on (see FastOsuParser__TimingAt())
+        FastOsuParser__HitObjectTiming* hit_object_timings; // For each hit object
+
+        // Statistics (FastOsuParser__PARSE_STATS, also parses [Difficulty], [Events] & [TimingPoints]):
+        FastOsuParser__Stats stats;
+
+        // Digests of the whole file (FastOsuParser__PARSE_MD5/_HASH, computed in one pass over it before parsing):
+        unsigned char md5[16]; // (what osu! identifies beatmaps by)
+        uint64_t hash; // XXH64, for deduplication & caching
+
+#if defined(FASTOSUPARSER_PROFILE)
+        FastOsuParser__Profile profile;
+#endif
+
+        // Slider paths (only after FastOsuParser__ComputeSliderPaths()):
+        FastOsuParser__SliderPath* slider_paths;
+        size_t slider_paths_count;
+
+        int parse_flags; // (optional) Set before parsing to only parse some sections/fields (FastOsuParser__PARSE_*), 0 = everything
+        FastOsuParser__Allocator allocator; // (optional) Set before parsing to allocate through your own callbacks instead of malloc()/free()
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringPool* string_pool; // Set before parsing to the pool the strings above go into (NULL = don't keep them)
+#endif
+        void* _arena; // Single allocation backing all of the arrays above
+        void* _paths; // (slider paths are added later, so they have their own)
 
 } FastOsuParser__Beatmap;
 
@@ -112,639 +469,5869 @@ typedef enum {
         FastOsuParser__ERROR_SECTION_METADATA_TITLE_TOO_LONG,
         FastOsuParser__ERROR_SECTION_METADATA_ARTIST_TOO_LONG,
         FastOsuParser__ERROR_SECTION_METADATA_CREATOR_TOO_LONG,
-        FastOsuParser__ERROR_SECTION_METADATA_VERSION_TOO_LONG
+        FastOsuParser__ERROR_SECTION_METADATA_VERSION_TOO_LONG,
+        FastOsuParser__ERROR_FAILED_TO_MAP_FILE, // (codes are only ever added at the end, so that stored values keep their meaning)
+        FastOsuParser__ERROR_FAILED_TO_WRITE_FILE,
+        FastOsuParser__ERROR_CACHE_INVALID, // Not a cache file (or from another version/build), or corrupted
+        FastOsuParser__ERROR_CACHE_STALE, // Made from an older version of the source file
+        FastOsuParser__ERROR_DUPLICATE_FILE // Same contents as an earlier path of the batch, not parsed (FastOsuParser__BatchOptions.b_skip_duplicates)
 } FastOsuParser__Error;
 
-// Make sure "*out" is 0-initialized
-FastOsuParser__Error FastOsuParser__Parse(char* path, FastOsuParser__Beatmap* out) {
+// Locale-independent atoi() that leaves "*i" right after the number
+FASTOSUPARSER_DEF int _FastOsuParser__ParseInt(const char** i) {
 
-        out->_total_curve_points = malloc(0); // For freeing dynamic memory in FastOsuParser__Free()
+        const char* p = *i;
+        while (*p == ' ') p++;
 
+        char b_negative = (*p == '-');
+        p += (*p == '-' || *p == '+');
 
+        unsigned int value = 0;
+        for (unsigned int digit; (digit = (unsigned char)*p - '0') < 10; p++) value = value*10 + digit;
 
-        FILE* beatmap_file = fopen(path, "rb"); //
-        if (beatmap_file == NULL) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+        *i = p;
 
-        if (fseek(beatmap_file, 0, SEEK_END) != 0) return FastOsuParser__ERROR_FAILED_TO_SEEK_FILE_END;
-        long beatmap_file_size = ftell(beatmap_file); //
-        if (beatmap_file_size == -1L) return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
-        if (fseek(beatmap_file, 0, SEEK_SET) != 0) return FastOsuParser__ERROR_FAILED_TO_SEEK_FILE_START;
+        return (int)(b_negative ? 0U-value : value);
 
-        char* beatmap_file_contents = malloc(beatmap_file_size); //
-        if (beatmap_file_contents == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
-        if (fread(beatmap_file_contents, 1, beatmap_file_size, beatmap_file) < beatmap_file_size) return FastOsuParser__ERROR_FAILED_TO_READ_FILE;
+}
 
-        if (fclose(beatmap_file) != 0) return FastOsuParser__ERROR_FAILED_TO_CLOSE_FILE;
+static const double _FastOsuParser__POWERS_OF_TEN[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// 10^-348..10^347 as { high 64 bits, low 64 bits } (generated by tools/gen_powers_of_ten.py)
+static const uint64_t _FastOsuParser__POWERS_OF_TEN_128[][2] = {
+        { 0xFA8FD5A0081C0288ULL, 0x1732C869CD60E453ULL }, { 0x9C99E58405118195ULL, 0x0E7FBD42205C8EB4ULL },
+        { 0xC3C05EE50655E1FAULL, 0x521FAC92A873B261ULL }, { 0xF4B0769E47EB5A78ULL, 0xE6A797B752909EF9ULL },
+        { 0x98EE4A22ECF3188BULL, 0x9028BED2939A635CULL }, { 0xBF29DCABA82FDEAEULL, 0x7432EE873880FC33ULL },
+        { 0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL }, { 0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL },
+        { 0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL }, { 0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL },
+        { 0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL }, { 0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL },
+        { 0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL }, { 0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL },
+        { 0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL }, { 0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL },
+        { 0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL }, { 0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL },
+        { 0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL }, { 0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL },
+        { 0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL }, { 0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL },
+        { 0x84A57695FE98746DULL, 0x014BB630F7604B57ULL }, { 0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL },
+        { 0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL }, { 0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL },
+        { 0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL }, { 0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL },
+        { 0xFD00B897478238D0ULL, 0x8920B098955522B4ULL }, { 0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL },
+        { 0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL }, { 0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL },
+        { 0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL }, { 0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL },
+        { 0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL }, { 0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL },
+        { 0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL }, { 0xEBA09271E88D976BULL, 0xF7864A44C633682EULL },
+        { 0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL }, { 0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL },
+        { 0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL }, { 0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL },
+        { 0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL }, { 0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL },
+        { 0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL }, { 0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL },
+        { 0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL }, { 0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL },
+        { 0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL }, { 0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL },
+        { 0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL }, { 0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL },
+        { 0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL }, { 0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL },
+        { 0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL }, { 0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL },
+        { 0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL }, { 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL },
+        { 0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL }, { 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL },
+        { 0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL }, { 0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL },
+        { 0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL }, { 0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL },
+        { 0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL }, { 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL },
+        { 0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL }, { 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL },
+        { 0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL }, { 0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL },
+        { 0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL }, { 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL },
+        { 0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL }, { 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL },
+        { 0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL }, { 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL },
+        { 0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL }, { 0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL },
+        { 0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL }, { 0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL },
+        { 0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL }, { 0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL },
+        { 0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL }, { 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL },
+        { 0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL }, { 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL },
+        { 0xC987434744AC874EULL, 0xA327FFB266B56220ULL }, { 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL },
+        { 0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL }, { 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL },
+        { 0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL }, { 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL },
+        { 0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL }, { 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL },
+        { 0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL }, { 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL },
+        { 0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL }, { 0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL },
+        { 0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL }, { 0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL },
+        { 0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL }, { 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL },
+        { 0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL }, { 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL },
+        { 0xAECC49914078536DULL, 0x58FAE9F773886E18ULL }, { 0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL },
+        { 0x888F99797A5E012DULL, 0x6D8406C952429603ULL }, { 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL },
+        { 0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL }, { 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL },
+        { 0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL }, { 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL },
+        { 0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL }, { 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL },
+        { 0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL }, { 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL },
+        { 0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL }, { 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL },
+        { 0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL }, { 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL },
+        { 0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL }, { 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL },
+        { 0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL }, { 0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL },
+        { 0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL }, { 0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL },
+        { 0xB913179899F68584ULL, 0x28E2557B59846E3FULL }, { 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL },
+        { 0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL }, { 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL },
+        { 0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL }, { 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL },
+        { 0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL }, { 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL },
+        { 0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL }, { 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL },
+        { 0xD77485CB25823AC7ULL, 0x7D633293366B828BULL }, { 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL },
+        { 0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL }, { 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL },
+        { 0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL }, { 0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL },
+        { 0xCD795BE870516656ULL, 0x67902E276C921F8BULL }, { 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL },
+        { 0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL }, { 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL },
+        { 0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL }, { 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL },
+        { 0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL }, { 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL },
+        { 0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL }, { 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL },
+        { 0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL }, { 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL },
+        { 0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL }, { 0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL },
+        { 0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL }, { 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL },
+        { 0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL }, { 0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL },
+        { 0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL }, { 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL },
+        { 0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL }, { 0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL },
+        { 0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL }, { 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL },
+        { 0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL }, { 0xD47487CC8470652BULL, 0x7647C3200069671FULL },
+        { 0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL }, { 0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL },
+        { 0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL }, { 0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL },
+        { 0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL }, { 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL },
+        { 0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL }, { 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL },
+        { 0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL }, { 0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL },
+        { 0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL }, { 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL },
+        { 0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL }, { 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL },
+        { 0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL }, { 0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL },
+        { 0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL }, { 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL },
+        { 0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL }, { 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL },
+        { 0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL }, { 0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL },
+        { 0x8C974F7383725573ULL, 0x1E414218C73A13FBULL }, { 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL },
+        { 0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL }, { 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL },
+        { 0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL }, { 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL },
+        { 0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL }, { 0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL },
+        { 0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL }, { 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL },
+        { 0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL }, { 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL },
+        { 0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL }, { 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL },
+        { 0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL }, { 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL },
+        { 0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL }, { 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL },
+        { 0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL }, { 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL },
+        { 0xBE89523386091465ULL, 0xF6BBB397F1135823ULL }, { 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL },
+        { 0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL }, { 0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL },
+        { 0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL }, { 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL },
+        { 0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL }, { 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL },
+        { 0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL }, { 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL },
+        { 0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL }, { 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL },
+        { 0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL }, { 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL },
+        { 0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL }, { 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL },
+        { 0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL }, { 0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL },
+        { 0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL }, { 0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL },
+        { 0x811CCC668829B887ULL, 0x0806357D5A3F525FULL }, { 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL },
+        { 0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL }, { 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL },
+        { 0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL }, { 0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL },
+        { 0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL }, { 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL },
+        { 0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL }, { 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL },
+        { 0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL }, { 0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL },
+        { 0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL }, { 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL },
+        { 0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL }, { 0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL },
+        { 0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL }, { 0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL },
+        { 0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL }, { 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL },
+        { 0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL }, { 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL },
+        { 0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL }, { 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL },
+        { 0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL }, { 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL },
+        { 0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL }, { 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL },
+        { 0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL }, { 0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL },
+        { 0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL }, { 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL },
+        { 0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL }, { 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL },
+        { 0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL }, { 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL },
+        { 0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL }, { 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL },
+        { 0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL }, { 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL },
+        { 0xED246723473E3813ULL, 0x290123E9AAB23B68ULL }, { 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL },
+        { 0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL }, { 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL },
+        { 0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL }, { 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL },
+        { 0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL }, { 0x8D590723948A535FULL, 0x579C487E5A38AD0EULL },
+        { 0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL }, { 0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL },
+        { 0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL }, { 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL },
+        { 0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL }, { 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL },
+        { 0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL }, { 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL },
+        { 0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL }, { 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL },
+        { 0xCDB02555653131B6ULL, 0x3792F412CB06794DULL }, { 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL },
+        { 0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL }, { 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL },
+        { 0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL }, { 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL },
+        { 0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL }, { 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL },
+        { 0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL }, { 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL },
+        { 0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL }, { 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL },
+        { 0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL }, { 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL },
+        { 0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL }, { 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL },
+        { 0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL }, { 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL },
+        { 0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL }, { 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL },
+        { 0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL }, { 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL },
+        { 0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL }, { 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL },
+        { 0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL }, { 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL },
+        { 0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL }, { 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL },
+        { 0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL }, { 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL },
+        { 0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL }, { 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL },
+        { 0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL }, { 0x9E74D1B791E07E48ULL, 0x775EA264CF55347DULL },
+        { 0xC612062576589DDAULL, 0x95364AFE032A819DULL }, { 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52204ULL },
+        { 0x9ABE14CD44753B52ULL, 0xC4926A9672793542ULL }, { 0xC16D9A0095928A27ULL, 0x75B7053C0F178293ULL },
+        { 0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6338ULL }, { 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E03ULL },
+        { 0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF584ULL }, { 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E5ULL },
+        { 0x9392EE8E921D5D07ULL, 0x3AFF322E62439FCFULL }, { 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C2ULL },
+        { 0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B3ULL }, { 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A10ULL },
+        { 0xB424DC35095CD80FULL, 0x538484C19EF38C94ULL }, { 0xE12E13424BB40E13ULL, 0x2865A5F206B06FB9ULL },
+        { 0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D3ULL }, { 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D748ULL },
+        { 0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1BULL }, { 0x89705F4136B4A597ULL, 0x31680A88F8953030ULL },
+        { 0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3DULL }, { 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4CULL },
+        { 0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B10FULL }, { 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D53ULL },
+        { 0xD1B71758E219652BULL, 0xD3C36113404EA4A8ULL }, { 0x83126E978D4FDF3BULL, 0x645A1CAC083126E9ULL },
+        { 0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A3ULL }, { 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCCULL },
+        { 0x8000000000000000ULL, 0x0000000000000000ULL }, { 0xA000000000000000ULL, 0x0000000000000000ULL },
+        { 0xC800000000000000ULL, 0x0000000000000000ULL }, { 0xFA00000000000000ULL, 0x0000000000000000ULL },
+        { 0x9C40000000000000ULL, 0x0000000000000000ULL }, { 0xC350000000000000ULL, 0x0000000000000000ULL },
+        { 0xF424000000000000ULL, 0x0000000000000000ULL }, { 0x9896800000000000ULL, 0x0000000000000000ULL },
+        { 0xBEBC200000000000ULL, 0x0000000000000000ULL }, { 0xEE6B280000000000ULL, 0x0000000000000000ULL },
+        { 0x9502F90000000000ULL, 0x0000000000000000ULL }, { 0xBA43B74000000000ULL, 0x0000000000000000ULL },
+        { 0xE8D4A51000000000ULL, 0x0000000000000000ULL }, { 0x9184E72A00000000ULL, 0x0000000000000000ULL },
+        { 0xB5E620F480000000ULL, 0x0000000000000000ULL }, { 0xE35FA931A0000000ULL, 0x0000000000000000ULL },
+        { 0x8E1BC9BF04000000ULL, 0x0000000000000000ULL }, { 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL },
+        { 0xDE0B6B3A76400000ULL, 0x0000000000000000ULL }, { 0x8AC7230489E80000ULL, 0x0000000000000000ULL },
+        { 0xAD78EBC5AC620000ULL, 0x0000000000000000ULL }, { 0xD8D726B7177A8000ULL, 0x0000000000000000ULL },
+        { 0x878678326EAC9000ULL, 0x0000000000000000ULL }, { 0xA968163F0A57B400ULL, 0x0000000000000000ULL },
+        { 0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL }, { 0x84595161401484A0ULL, 0x0000000000000000ULL },
+        { 0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL }, { 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL },
+        { 0x813F3978F8940984ULL, 0x4000000000000000ULL }, { 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL },
+        { 0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL }, { 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL },
+        { 0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL }, { 0xC5371912364CE305ULL, 0x6C28000000000000ULL },
+        { 0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL }, { 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL },
+        { 0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL }, { 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL },
+        { 0x96769950B50D88F4ULL, 0x1314448000000000ULL }, { 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL },
+        { 0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL }, { 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL },
+        { 0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL }, { 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL },
+        { 0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL }, { 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL },
+        { 0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL }, { 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL },
+        { 0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL }, { 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL },
+        { 0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL }, { 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL },
+        { 0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL }, { 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL },
+        { 0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL }, { 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL },
+        { 0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL }, { 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL },
+        { 0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL }, { 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL },
+        { 0x9F4F2726179A2245ULL, 0x01D762422C946590ULL }, { 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL },
+        { 0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL }, { 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL },
+        { 0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL }, { 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL },
+        { 0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL }, { 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL },
+        { 0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL }, { 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL },
+        { 0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL }, { 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL },
+        { 0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL }, { 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL },
+        { 0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL }, { 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL },
+        { 0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL }, { 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL },
+        { 0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL }, { 0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL },
+        { 0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL }, { 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL },
+        { 0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL }, { 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL },
+        { 0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL }, { 0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL },
+        { 0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL }, { 0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL },
+        { 0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL }, { 0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL },
+        { 0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL }, { 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL },
+        { 0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL }, { 0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL },
+        { 0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL }, { 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL },
+        { 0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL }, { 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL },
+        { 0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL }, { 0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL },
+        { 0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL }, { 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL },
+        { 0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL }, { 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL },
+        { 0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL }, { 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL },
+        { 0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL }, { 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL },
+        { 0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL }, { 0x884134FE908658B2ULL, 0x3109058D147FDCDDULL },
+        { 0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL }, { 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL },
+        { 0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL }, { 0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL },
+        { 0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL }, { 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL },
+        { 0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL }, { 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL },
+        { 0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL }, { 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL },
+        { 0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL }, { 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL },
+        { 0x9AE757596946075FULL, 0x3375788DE9B06958ULL }, { 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL },
+        { 0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL }, { 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL },
+        { 0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL }, { 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL },
+        { 0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL }, { 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL },
+        { 0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL }, { 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL },
+        { 0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL }, { 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL },
+        { 0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL }, { 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL },
+        { 0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL }, { 0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL },
+        { 0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL }, { 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL },
+        { 0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL }, { 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL },
+        { 0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL }, { 0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL },
+        { 0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL }, { 0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL },
+        { 0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL }, { 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL },
+        { 0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL }, { 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL },
+        { 0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL }, { 0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL },
+        { 0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL }, { 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL },
+        { 0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL }, { 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL },
+        { 0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL }, { 0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL },
+        { 0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL }, { 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL },
+        { 0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL }, { 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL },
+        { 0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL }, { 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL },
+        { 0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL }, { 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL },
+        { 0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL }, { 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL },
+        { 0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL }, { 0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL },
+        { 0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL }, { 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL },
+        { 0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL }, { 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL },
+        { 0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL }, { 0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL },
+        { 0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL }, { 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL },
+        { 0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL }, { 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL },
+        { 0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL }, { 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL },
+        { 0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL }, { 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL },
+        { 0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL }, { 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL },
+        { 0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL }, { 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL },
+        { 0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL }, { 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL },
+        { 0x8FA475791A569D10ULL, 0xF96E017D694487BCULL }, { 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL },
+        { 0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL }, { 0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL },
+        { 0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL }, { 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL },
+        { 0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL }, { 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL },
+        { 0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL }, { 0x85C7056562757456ULL, 0xF6872D5667844E49ULL },
+        { 0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL }, { 0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL },
+        { 0x82A45B450226B39CULL, 0xECC0024661173473ULL }, { 0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL },
+        { 0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL }, { 0xFF290242C83396CEULL, 0x7E67047175A15271ULL },
+        { 0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL }, { 0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL },
+        { 0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL }, { 0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL },
+        { 0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL }, { 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL },
+        { 0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL }, { 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL },
+        { 0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL }, { 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL },
+        { 0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL }, { 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL },
+        { 0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL }, { 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL },
+        { 0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL }, { 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL },
+        { 0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL }, { 0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL },
+        { 0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL }, { 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL },
+        { 0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL }, { 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL },
+        { 0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL }, { 0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL },
+        { 0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL }, { 0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL },
+        { 0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL }, { 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL },
+        { 0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL }, { 0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL },
+        { 0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL }, { 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL },
+        { 0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL }, { 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL },
+        { 0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL }, { 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL },
+        { 0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL }, { 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL },
+        { 0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL }, { 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL },
+        { 0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL }, { 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL },
+        { 0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL }, { 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL },
+        { 0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL }, { 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL },
+        { 0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL }, { 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL },
+        { 0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL }, { 0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL },
+        { 0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL }, { 0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL },
+        { 0x8533285C936B35DEULL, 0xD53A88958F87275FULL }, { 0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL },
+        { 0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL }, { 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL },
+        { 0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL }, { 0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL },
+        { 0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL }, { 0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL },
+        { 0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL }, { 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL },
+        { 0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL }, { 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL },
+        { 0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL }, { 0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL },
+        { 0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL }, { 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL },
+        { 0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL }, { 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL },
+        { 0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL }, { 0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL },
+        { 0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL }, { 0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL },
+        { 0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL }, { 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL },
+        { 0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL }, { 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL },
+        { 0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL }, { 0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL },
+        { 0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL }, { 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL },
+        { 0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL }, { 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL },
+        { 0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL }, { 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL },
+        { 0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL }, { 0xA0555E361951C366ULL, 0xD7E105BCC332621FULL },
+        { 0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL }, { 0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL },
+        { 0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL }, { 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL },
+        { 0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL }, { 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL },
+        { 0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL }, { 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL },
+        { 0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL }, { 0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL },
+        { 0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL }, { 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL },
+        { 0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL }, { 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL },
+        { 0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL }, { 0xB201833B35D63F73ULL, 0x2CD2CC6551E513DAULL },
+        { 0xDE81E40A034BCF4FULL, 0xF8077F7EA65E58D1ULL }, { 0x8B112E86420F6191ULL, 0xFB04AFAF27FAF782ULL },
+        { 0xADD57A27D29339F6ULL, 0x79C5DB9AF1F9B563ULL }, { 0xD94AD8B1C7380874ULL, 0x18375281AE7822BCULL },
+        { 0x87CEC76F1C830548ULL, 0x8F2293910D0B15B5ULL }, { 0xA9C2794AE3A3C69AULL, 0xB2EB3875504DDB22ULL },
+        { 0xD433179D9C8CB841ULL, 0x5FA60692A46151EBULL }, { 0x849FEEC281D7F328ULL, 0xDBC7C41BA6BCD333ULL },
+        { 0xA5C7EA73224DEFF3ULL, 0x12B9B522906C0800ULL }, { 0xCF39E50FEAE16BEFULL, 0xD768226B34870A00ULL },
+        { 0x81842F29F2CCE375ULL, 0xE6A1158300D46640ULL }, { 0xA1E53AF46F801C53ULL, 0x60495AE3C1097FD0ULL },
+        { 0xCA5E89B18B602368ULL, 0x385BB19CB14BDFC4ULL }, { 0xFCF62C1DEE382C42ULL, 0x46729E03DD9ED7B5ULL },
+        { 0x9E19DB92B4E31BA9ULL, 0x6C07A2C26A8346D1ULL }, { 0xC5A05277621BE293ULL, 0xC7098B7305241885ULL },
+        { 0xF70867153AA2DB38ULL, 0xB8CBEE4FC66D1EA7ULL }, { 0x9A65406D44A5C903ULL, 0x737F74F1DC043328ULL },
+        { 0xC0FE908895CF3B44ULL, 0x505F522E53053FF2ULL }, { 0xF13E34AABB430A15ULL, 0x647726B9E7C68FEFULL },
+        { 0x96C6E0EAB509E64DULL, 0x5ECA783430DC19F5ULL }, { 0xBC789925624C5FE0ULL, 0xB67D16413D132072ULL },
+        { 0xEB96BF6EBADF77D8ULL, 0xE41C5BD18C57E88FULL }, { 0x933E37A534CBAAE7ULL, 0x8E91B962F7B6F159ULL },
+        { 0xB80DC58E81FE95A1ULL, 0x723627BBB5A4ADB0ULL }, { 0xE61136F2227E3B09ULL, 0xCEC3B1AAA30DD91CULL },
+        { 0x8FCAC257558EE4E6ULL, 0x213A4F0AA5E8A7B1ULL }, { 0xB3BD72ED2AF29E1FULL, 0xA988E2CD4F62D19DULL },
+        { 0xE0ACCFA875AF45A7ULL, 0x93EB1B80A33B8605ULL }, { 0x8C6C01C9498D8B88ULL, 0xBC72F130660533C3ULL },
+        { 0xAF87023B9BF0EE6AULL, 0xEB8FAD7C7F8680B4ULL }, { 0xDB68C2CA82ED2A05ULL, 0xA67398DB9F6820E1ULL },
+        { 0x892179BE91D43A43ULL, 0x88083F8943A1148CULL }, { 0xAB69D82E364948D4ULL, 0x6A0A4F6B948959B0ULL },
+        { 0xD6444E39C3DB9B09ULL, 0x848CE34679ABB01CULL }, { 0x85EAB0E41A6940E5ULL, 0xF2D80E0C0C0B4E11ULL },
+        { 0xA7655D1D2103911FULL, 0x6F8E118F0F0E2195ULL }, { 0xD13EB46469447567ULL, 0x4B7195F2D2D1A9FBULL }
+};
+
+FASTOSUPARSER_DEF int _FastOsuParser__Clz64(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_clzll(x);
+#else
+        int n = 0;
+        while (!(x & (1ULL << 63))) { x <<= 1; n++; }
+        return n;
+#endif
+}
 
+// High 64 bits of "a" * "b" (the low ones go into "*low")
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__Multiply128(uint64_t a, uint64_t b, uint64_t* low) {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = (unsigned __int128)a * b;
+        *low = (uint64_t)product;
+        return (uint64_t)(product >> 64);
+#else
+        uint64_t low_low = (a & 0xFFFFFFFF) * (b & 0xFFFFFFFF);
+        uint64_t low_high = (a & 0xFFFFFFFF) * (b >> 32);
+        uint64_t high_low = (a >> 32) * (b & 0xFFFFFFFF);
+        uint64_t high_high = (a >> 32) * (b >> 32);
+        uint64_t middle = (low_low >> 32) + (low_high & 0xFFFFFFFF) + (high_low & 0xFFFFFFFF);
+        *low = (middle << 32) | (low_low & 0xFFFFFFFF);
+        return high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+}
 
+// Eisel-Lemire: "mantissa" * 10^"exponent" correctly rounded into "*value", 0 if it can't be sure (close to halfway, subnormal or infinite)
+FASTOSUPARSER_DEF char _FastOsuParser__EiselLemire(uint64_t mantissa, int exponent, double* value) {
 
-        enum {
-                SECTION_NONE, // *none of the desired sections
-                SECTION_GENERAL,
-                SECTION_METADATA,
-                SECTION_DIFFICULTY,
-                SECTION_TIMING_POINTS,
-                SECTION_HIT_OBJECTS
-        } current_section = SECTION_NONE;
+        if (mantissa == 0) {
+                *value = 0.0;
+                return 1;
+        }
+        if (exponent < -348 || exponent > 347) return 0;
+
+        int leading_zeros = _FastOsuParser__Clz64(mantissa);
+        mantissa <<= leading_zeros;
+        int64_t binary_exponent = (int64_t)(((exponent * 217706) >> 16) + 64 + 1023) - leading_zeros; // (217706/2^16 ~ log2(10))
+
+        const uint64_t* power = _FastOsuParser__POWERS_OF_TEN_128[exponent + 348];
+        uint64_t low;
+        uint64_t high = _FastOsuParser__Multiply128(mantissa, power[0], &low);
+
+        // The power's lower 64 bits only matter if the product's lowest 9 kept bits could still carry
+        if ((high & 0x1FF) == 0x1FF && low + mantissa < mantissa) {
+                uint64_t wide_low;
+                uint64_t wide_high = _FastOsuParser__Multiply128(mantissa, power[1], &wide_low);
+                uint64_t merged_high = high;
+                uint64_t merged_low = low + wide_high;
+                merged_high += (merged_low < low);
+                if ((merged_high & 0x1FF) == 0x1FF && merged_low + 1 == 0 && wide_low + mantissa < mantissa) return 0;
+                high = merged_high;
+                low = merged_low;
+        }
 
-        char* i = beatmap_file_contents; // Current beatmap file content index
-        while (*i != '[') i++; // Skip to first section
-        for (; i < beatmap_file_contents+beatmap_file_size; i++) {
+        // 54 bits, then rounded half to even into 53
+        uint64_t top_bit = high >> 63;
+        uint64_t result = high >> (top_bit + 9);
+        binary_exponent -= 1 ^ top_bit;
 
-                if (*i == '[') { // If new section:
+        if (low == 0 && (high & 0x1FF) == 0 && (result & 3) == 1) return 0; // (might be exactly halfway)
 
-                        i++;
-                        switch (*i) { // Update current_section state based on first letter
+        result += result & 1;
+        result >>= 1;
+        if (result >> 53) {
+                result >>= 1;
+                binary_exponent++;
+        }
 
-                                case 'G':
-                                        current_section = SECTION_GENERAL;
-                                        i += sizeof("eneral]\r\n"); // Skip to next line
-                                break;
+        if ((uint64_t)(binary_exponent - 1) >= 0x7FF - 1) return 0;
 
-                                case 'M':
-                                        current_section = SECTION_METADATA;
-                                        i += sizeof("etadata]\r\n"); // Skip to next line
-                                break;
+        uint64_t bits = (uint64_t)binary_exponent << 52 | (result & 0x000FFFFFFFFFFFFFULL);
+        memcpy(value, &bits, sizeof(bits));
 
-                                case 'D':
-                                        current_section = SECTION_DIFFICULTY;
-                                        i += sizeof("ifficulty]\r\n"); // Skip to next line
-                                break;
+        return 1;
 
-                                case 'T':
-                                        current_section = SECTION_TIMING_POINTS;
-                                        i += sizeof("imingPoints]\r\n"); // Skip to next line
-                                break;
+}
 
-                                case 'H':
-                                        current_section = SECTION_HIT_OBJECTS;
-                                        i += sizeof("itObjects]\r\n"); // Skip to next line
-                                break;
+// Big enough for any number that doesn't round to 0 or infinity (800 digits & the powers of 5 they're divided by, shifted)
+#define _FASTOSUPARSER_BIGINT_WORDS 128
 
-                                default: current_section = SECTION_NONE;
+typedef struct {
+        uint32_t words[_FASTOSUPARSER_BIGINT_WORDS]; // Least significant first
+        int size; // (words in use, the highest one isn't 0)
+} _FastOsuParser__Bigint;
 
-                        }
+FASTOSUPARSER_DEF void _FastOsuParser__BigintMultiply(_FastOsuParser__Bigint* x, uint32_t factor, uint32_t addend) {
 
-                }
+        uint64_t carry = addend;
+        for (int n = 0; n < x->size; n++) {
+                carry += (uint64_t)x->words[n] * factor;
+                x->words[n] = (uint32_t)carry;
+                carry >>= 32;
+        }
+        if (carry != 0) x->words[x->size++] = (uint32_t)carry;
 
+}
 
+FASTOSUPARSER_DEF void _FastOsuParser__BigintMultiplyPowerOfFive(_FastOsuParser__Bigint* x, int exponent) {
+        for (; exponent >= 13; exponent -= 13) _FastOsuParser__BigintMultiply(x, 1220703125, 0); // (5^13, the biggest that fits)
+        uint32_t factor = 1;
+        while (exponent-- > 0) factor *= 5;
+        _FastOsuParser__BigintMultiply(x, factor, 0);
+}
 
-                switch (current_section) {
+FASTOSUPARSER_DEF void _FastOsuParser__BigintShiftLeft(_FastOsuParser__Bigint* x, int bits) {
 
-                        case SECTION_NONE: break;
+        if (x->size == 0) return;
 
+        int word_shift = bits / 32;
+        int bit_shift = bits % 32;
 
+        x->words[x->size + word_shift] = 0;
+        for (int n = x->size-1; n >= 0; n--) {
+                if (bit_shift != 0) x->words[n + word_shift + 1] |= x->words[n] >> (32 - bit_shift);
+                x->words[n + word_shift] = x->words[n] << bit_shift;
+        }
+        for (int n = 0; n < word_shift; n++) x->words[n] = 0;
 
-                        case SECTION_GENERAL:
+        x->size += word_shift + 1;
+        while (x->size > 0 && x->words[x->size-1] == 0) x->size--;
 
-                                switch (*i) {
+}
 
-                                        case 'A': // [A]udio...
+FASTOSUPARSER_DEF void _FastOsuParser__BigintShiftRightOne(_FastOsuParser__Bigint* x) {
+        for (int n = 0; n < x->size; n++) x->words[n] = (x->words[n] >> 1) | ((n+1 < x->size) ? x->words[n+1] << 31 : 0);
+        while (x->size > 0 && x->words[x->size-1] == 0) x->size--;
+}
 
-                                                i += sizeof("udio"); // Skip to next unique letter
-                                                switch (*i) { // Check next unique letter ("Audio[X]...")
+FASTOSUPARSER_DEF int _FastOsuParser__BigintCompare(const _FastOsuParser__Bigint* a, const _FastOsuParser__Bigint* b) {
+        if (a->size != b->size) return (a->size < b->size) ? -1 : 1;
+        for (int n = a->size-1; n >= 0; n--) if (a->words[n] != b->words[n]) return (a->words[n] < b->words[n]) ? -1 : 1;
+        return 0;
+}
 
-                                                        case 'F': // Audio[F]ilename
-                                                        {
+// "a" -= "b" ("a" >= "b")
+FASTOSUPARSER_DEF void _FastOsuParser__BigintSubtract(_FastOsuParser__Bigint* a, const _FastOsuParser__Bigint* b) {
 
-                                                                i += sizeof("ilename: "); // Skip to content
+        int64_t borrow = 0;
+        for (int n = 0; n < a->size; n++) {
+                int64_t difference = (int64_t)a->words[n] - ((n < b->size) ? b->words[n] : 0) - borrow;
+                borrow = (difference < 0);
+                a->words[n] = (uint32_t)(difference + (borrow << 32));
+        }
+        while (a->size > 0 && a->words[a->size-1] == 0) a->size--;
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
-                                                                if (content_size > 255) return FastOsuParser__ERROR_SECTION_GENERAL_AUDIOFILENAME_TOO_LONG;
+}
 
-                                                                memcpy(&out->audio_file_name, i, content_size);
-                                                                out->audio_file_name_size = content_size;
+FASTOSUPARSER_DEF int _FastOsuParser__BigintBits(const _FastOsuParser__Bigint* x) {
+        if (x->size == 0) return 0;
+        return 32*(x->size-1) + (64 - _FastOsuParser__Clz64(x->words[x->size-1]));
+}
 
-                                                                i += content_size+1; // Skip to next line
+// ("top" + a bit more if "b_sticky") * 2^"exponent" rounded half to even, "top" has its highest bit set
+FASTOSUPARSER_DEF double _FastOsuParser__RoundToDouble(uint64_t top, char b_sticky, int64_t exponent) {
 
-                                                        }
-                                                        break;
+        int64_t highest_bit = exponent + 63;
 
-                                                        case 'L': // Audio[L]eadIn
-                                                        {
+        // 53 bits for normal numbers, fewer for subnormals
+        int shift = 11;
+        if (highest_bit < -1022) {
+                if (-1022 - highest_bit > 53) return 0.0; // (below half the smallest subnormal)
+                shift += (int)(-1022 - highest_bit);
+        }
 
-                                                                i += sizeof("eadIn: "); // Skip to content
+        uint64_t mantissa = (shift == 64) ? 0 : top >> shift;
+        uint64_t remainder = (shift == 64) ? top : top & ((1ULL << shift) - 1);
+        uint64_t half = 1ULL << (shift-1);
+        if (remainder > half || (remainder == half && (b_sticky || (mantissa & 1)))) mantissa++;
+
+        uint64_t bits;
+        if (highest_bit < -1022) bits = mantissa; // (rounding up into the smallest normal number carries into its exponent on its own)
+        else {
+                if (mantissa >> 53) {
+                        mantissa >>= 1;
+                        highest_bit++;
+                }
+                if (highest_bit > 1023) return HUGE_VAL;
+                bits = (uint64_t)(highest_bit + 1023) << 52 | (mantissa & 0x000FFFFFFFFFFFFFULL);
+        }
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+        double value;
+        memcpy(&value, &bits, sizeof(bits));
 
-                                                                out->audio_lead_in = atoi(i);
+        return value;
 
-                                                                i += content_size+1; // Skip to next line
+}
 
-                                                        }
-                                                        break;
+// Exact fallback for what the fast paths can't round with certainty (very long, close to halfway, subnormal or huge numbers)
+// Big integer arithmetic instead of strtod(), which depends on the (process-wide) locale
+FASTOSUPARSER_DEF double _FastOsuParser__ParseDoubleSlow(const char* start, const char* end) {
+
+        const char* p = start;
+        char b_negative = (*p == '-');
+        p += (*p == '-' || *p == '+');
+
+        // Value = digits * 10^exponent, keeping 800 significant digits (more can't change the rounding, only whether they're all 0)
+        _FastOsuParser__Bigint digits;
+        digits.size = 0;
+        int digits_count = 0;
+        int64_t exponent = 0;
+        char b_truncated = 0;
+
+        for (char b_fraction = 0;; p++) {
+                if (p >= end) break;
+                if (*p == '.' && !b_fraction) {
+                        b_fraction = 1;
+                        continue;
+                }
+                unsigned int digit = (unsigned char)*p - '0';
+                if (digit >= 10) break;
 
-                                                }
+                if (digits_count < 800) {
+                        if (digits_count != 0 || digit != 0) {
+                                _FastOsuParser__BigintMultiply(&digits, 10, digit);
+                                digits_count++;
+                        }
+                        exponent -= b_fraction;
+                }
+                else {
+                        b_truncated |= (digit != 0);
+                        exponent += !b_fraction;
+                }
+        }
 
-                                        break;
+        if (p < end && (*p == 'e' || *p == 'E')) {
+                p++;
+                char b_negative_exponent = (*p == '-');
+                p += (*p == '-' || *p == '+');
 
-                                        case 'C': // [C]ountdown[...]
+                int64_t explicit_exponent = 0;
+                for (unsigned int digit; p < end && (digit = (unsigned char)*p - '0') < 10; p++) if (explicit_exponent < 1000000000) explicit_exponent = explicit_exponent*10 + digit;
 
-                                                i += sizeof("ountdown"); // Move to next unique character
-                                                switch (*i) { // Check next unique character
+                exponent += b_negative_exponent ? -explicit_exponent : explicit_exponent;
+        }
 
-                                                        case ':': // Countdown[:]
-                                                        {
+        // Dropped digits that weren't all 0 => a 1 after the kept ones rounds the same
+        if (b_truncated) {
+                _FastOsuParser__BigintMultiply(&digits, 10, 1);
+                digits_count++;
+                exponent--;
+        }
 
-                                                                i += sizeof(" "); // Skip to content
+        double value;
+        if (digits_count == 0 || digits_count + exponent < -324) value = 0.0; // (< 10^-325, below half the smallest subnormal)
+        else if (digits_count + exponent > 309) value = HUGE_VAL; // (>= 10^309)
+        else if (exponent >= 0) {
+                _FastOsuParser__BigintMultiplyPowerOfFive(&digits, (int)exponent);
+
+                // Highest 64 bits, & whether any below them are set
+                int bits = _FastOsuParser__BigintBits(&digits);
+                int shift = bits - 64;
+                char b_sticky = 0;
+                if (shift > 0) {
+                        for (int n = 0; n < shift/32; n++) b_sticky |= (digits.words[n] != 0);
+                        b_sticky |= (digits.words[shift/32] & ((1U << (shift%32)) - 1)) != 0;
+                }
+                uint64_t top = 0;
+                for (int bit = bits-1; bit >= bits-64; bit--) top = top << 1 | ((bit >= 0) ? (digits.words[bit/32] >> (bit%32)) & 1 : 0);
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+                value = _FastOsuParser__RoundToDouble(top, b_sticky, exponent + shift);
+        }
+        else {
+                // digits / 5^-exponent, scaled by 2^shift into a 63-64 bit quotient, by long division
+                _FastOsuParser__Bigint divisor;
+                divisor.size = 1;
+                divisor.words[0] = 1;
+                _FastOsuParser__BigintMultiplyPowerOfFive(&divisor, (int)-exponent);
+
+                int shift = 63 - (_FastOsuParser__BigintBits(&digits) - _FastOsuParser__BigintBits(&divisor));
+                if (shift > 0) _FastOsuParser__BigintShiftLeft(&digits, shift);
+                else _FastOsuParser__BigintShiftLeft(&divisor, -shift);
+                _FastOsuParser__BigintShiftLeft(&divisor, 63);
+
+                uint64_t quotient = 0;
+                for (int bit = 63; bit >= 0; bit--) {
+                        if (_FastOsuParser__BigintCompare(&digits, &divisor) >= 0) {
+                                _FastOsuParser__BigintSubtract(&digits, &divisor);
+                                quotient |= 1ULL << bit;
+                        }
+                        _FastOsuParser__BigintShiftRightOne(&divisor);
+                }
 
-                                                                out->countdown = atoi(i);
+                int64_t binary_exponent = exponent - shift;
+                if (!(quotient >> 63)) {
+                        quotient <<= 1;
+                        binary_exponent--;
+                }
 
-                                                                i += content_size+1; // Skip to next line
+                value = _FastOsuParser__RoundToDouble(quotient, digits.size != 0, binary_exponent);
+        }
 
-                                                        }
-                                                        break;
+        return b_negative ? -value : value;
 
-                                                        case 'O': // Countdown[O]ffset
-                                                        {
+}
 
-                                                                i += sizeof("ffset: "); // Skip to content
+// Locale-independent, correctly rounded atof() that leaves "*i" right after the number
+FASTOSUPARSER_DEF double _FastOsuParser__ParseDouble(const char** i) {
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+        const char* p = *i;
+        while (*p == ' ') p++;
+        const char* start = p;
 
-                                                                out->countdown_offset = atoi(i);
+        char b_negative = (*p == '-');
+        p += (*p == '-' || *p == '+');
 
-                                                                i += content_size+1; // Skip to next line
+        // Up to 19 significant digits fit in 64 bits
+        uint64_t mantissa = 0;
+        int significant_digits = 0;
+        int exponent = 0;
+        char b_truncated = 0;
 
-                                                        }
-                                                        break;
+        for (unsigned int digit; (digit = (unsigned char)*p - '0') < 10; p++) {
+                if (significant_digits < 19) {
+                        mantissa = mantissa*10 + digit;
+                        significant_digits += (mantissa != 0);
+                }
+                else {
+                        exponent++;
+                        b_truncated |= (digit != 0);
+                }
+        }
 
-                                                }
+        if (*p == '.') {
+                p++;
+                for (unsigned int digit; (digit = (unsigned char)*p - '0') < 10; p++) {
+                        if (significant_digits < 19) {
+                                mantissa = mantissa*10 + digit;
+                                significant_digits += (mantissa != 0);
+                                exponent--;
+                        }
+                        else b_truncated |= (digit != 0);
+                }
+        }
 
-                                        break;
+        if ((*p == 'e' || *p == 'E') && (isdigit((unsigned char)*(p+1)) || ((*(p+1) == '-' || *(p+1) == '+') && isdigit((unsigned char)*(p+2))))) {
+                p++;
+                char b_negative_exponent = (*p == '-');
+                p += (*p == '-' || *p == '+');
 
-                                        case 'S':
+                int explicit_exponent = 0;
+                for (unsigned int digit; (digit = (unsigned char)*p - '0') < 10; p++) if (explicit_exponent < 100000) explicit_exponent = explicit_exponent*10 + digit;
 
-                                                i += 7; // Skip to next unique letter
-                                                switch (*i) {
+                exponent += b_negative_exponent ? -explicit_exponent : explicit_exponent;
+                if (explicit_exponent >= 100000) { // (only ParseDoubleSlow() keeps exponents that big exactly)
+                        *i = p;
+                        return _FastOsuParser__ParseDoubleSlow(start, p);
+                }
+        }
 
-                                                        case 'n': // StackLe[n]iency
-                                                        {
+        *i = p;
 
-                                                                i += sizeof("iency: "); // Skip to content
+        // Exact mantissa & power of ten => one correctly rounded operation (Clinger's fast path)
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+        if (!b_truncated && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+                double value = (double)mantissa;
+                if (exponent < 0) value /= _FastOsuParser__POWERS_OF_TEN[-exponent];
+                else value *= _FastOsuParser__POWERS_OF_TEN[exponent];
+                return b_negative ? -value : value;
+        }
+#endif
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+        // Otherwise Eisel-Lemire, & if digits were dropped the value is between "mantissa" & "mantissa"+1 (scaled), so both have to round the same
+        double value;
+        double value_above;
+        if (_FastOsuParser__EiselLemire(mantissa, exponent, &value) && (!b_truncated || (_FastOsuParser__EiselLemire(mantissa+1, exponent, &value_above) && value == value_above))) {
+                return b_negative ? -value : value;
+        }
 
-                                                                out->stack_leniency = atof(i);
+        return _FastOsuParser__ParseDoubleSlow(start, p);
 
-                                                                i += content_size+1; // Skip to next line
+}
 
-                                                        }
-                                                        break;
+typedef enum {
+        _FastOsuParser__SECTION_NONE, // *none of the desired sections
+        _FastOsuParser__SECTION_GENERAL,
+        _FastOsuParser__SECTION_METADATA,
+        _FastOsuParser__SECTION_DIFFICULTY,
+        _FastOsuParser__SECTION_EVENTS,
+        _FastOsuParser__SECTION_TIMING_POINTS,
+        _FastOsuParser__SECTION_HIT_OBJECTS
+} _FastOsuParser__Section;
+
+enum {
+        _FastOsuParser__PARSE_EVENTS = 1 << 30 // [Events] has no public flag, it's only read for FastOsuParser__PARSE_STATS
+};
+
+// Bitmasks of interesting bytes in a 64-byte block (bit n <=> block[n])
+typedef struct {
+        uint64_t newline; // '\n'
+        uint64_t carriage_return; // '\r'
+        uint64_t bracket; // '['
+        uint64_t pipe; // '|'
+        uint64_t structural; // ',' ':' '|' '\n' (value separators)
+} _FastOsuParser__BlockMasks;
+
+FASTOSUPARSER_DEF int _FastOsuParser__Ctz64(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(x);
+#else
+        int n = 0;
+        while (!(x & 1)) { x >>= 1; n++; }
+        return n;
+#endif
+}
 
-                                                }
+FASTOSUPARSER_DEF int _FastOsuParser__Popcount64(uint64_t x) {
+#if defined(__GNUC__)
+        return __builtin_popcountll(x);
+#else
+        x = x - ((x >> 1) & 0x5555555555555555ULL);
+        x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+        x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return (x * 0x0101010101010101ULL) >> 56;
+#endif
+}
 
-                                        break;
+FASTOSUPARSER_DEF void _FastOsuParser__ClassifyScalar(const char* block, _FastOsuParser__BlockMasks* masks) {
 
-                                        case 'M': // [M]ode
-                                        {
+        memset(masks, 0, sizeof(*masks));
 
-                                                i += sizeof ("ode: "); // Skip to content
+        for (int n = 0; n < 64; n++) {
+                uint64_t bit = 1ULL << n;
+                switch (block[n]) {
+                        case '\n': masks->newline |= bit; masks->structural |= bit; break;
+                        case '\r': masks->carriage_return |= bit; break;
+                        case '[': masks->bracket |= bit; break;
+                        case '|': masks->pipe |= bit; masks->structural |= bit; break;
+                        case ',': case ':': masks->structural |= bit; break;
+                }
+        }
 
-                                                out->mode = atoi(i); // (single-digit)
+}
 
-                                                i += 2; // Skip to next line
+#if defined(_FASTOSUPARSER_X86)
 
-                                        }
-                                        break;
+__attribute__((target("sse2")))
+FASTOSUPARSER_DEF void _FastOsuParser__ClassifySSE2(const char* block, _FastOsuParser__BlockMasks* masks) {
 
-                                }
-                        
-                        break;
+        memset(masks, 0, sizeof(*masks));
 
+        for (int n = 0; n < 64; n += 16) {
+                __m128i bytes = _mm_loadu_si128((const __m128i*)(block+n));
+                __m128i newline = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'));
+                __m128i pipe = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('|'));
+                __m128i structural = _mm_or_si128(
+                        _mm_or_si128(newline, pipe),
+                        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(',')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8(':')))
+                );
 
+                masks->newline |= (uint64_t)(uint16_t)_mm_movemask_epi8(newline) << n;
+                masks->carriage_return |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r'))) << n;
+                masks->bracket |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('['))) << n;
+                masks->pipe |= (uint64_t)(uint16_t)_mm_movemask_epi8(pipe) << n;
+                masks->structural |= (uint64_t)(uint16_t)_mm_movemask_epi8(structural) << n;
+        }
 
-                        case SECTION_METADATA:
+}
 
-                                switch (*i) {
+__attribute__((target("avx2")))
+FASTOSUPARSER_DEF void _FastOsuParser__ClassifyAVX2(const char* block, _FastOsuParser__BlockMasks* masks) {
+
+        memset(masks, 0, sizeof(*masks));
+
+        for (int n = 0; n < 64; n += 32) {
+                __m256i bytes = _mm256_loadu_si256((const __m256i*)(block+n));
+                __m256i newline = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\n'));
+                __m256i pipe = _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('|'));
+                __m256i structural = _mm256_or_si256(
+                        _mm256_or_si256(newline, pipe),
+                        _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(',')), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(':')))
+                );
+
+                masks->newline |= (uint64_t)(uint32_t)_mm256_movemask_epi8(newline) << n;
+                masks->carriage_return |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\r'))) << n;
+                masks->bracket |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('['))) << n;
+                masks->pipe |= (uint64_t)(uint32_t)_mm256_movemask_epi8(pipe) << n;
+                masks->structural |= (uint64_t)(uint32_t)_mm256_movemask_epi8(structural) << n;
+        }
 
-                                        case 'T':
+}
 
-                                                i++; // Skip to next unique* letter
-                                                switch (*i) {
+#endif
 
-                                                        case 'i': // T[i]tle?
-                                                        {
+// Classifies the 64 bytes at "block" (bytes at/after "end" count as uninteresting)
+FASTOSUPARSER_DEF void _FastOsuParser__Classify(const char* block, const char* end, _FastOsuParser__BlockMasks* masks) {
 
-                                                                if (*(i+sizeof("tle")) == 'U') break; // Skip if "TitleUnicode"
+        char padded[64];
+        if (end-block < 64) { // Don't read past the end of the buffer
+                memset(padded, 0, sizeof(padded));
+                memcpy(padded, block, end-block);
+                block = padded;
+        }
 
-                                                                i += sizeof("tle:"); // Skip to content
+#if defined(_FASTOSUPARSER_X86)
+        if (__builtin_cpu_supports("avx2")) _FastOsuParser__ClassifyAVX2(block, masks);
+        else _FastOsuParser__ClassifySSE2(block, masks);
+#else
+        _FastOsuParser__ClassifyScalar(block, masks);
+#endif
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
-                                                                if (content_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_TITLE_TOO_LONG;
+}
 
-                                                                memcpy(&out->title, i, content_size);
-                                                                out->title_size = content_size;
+// Walks the value separators (',' ':' '|' '\n') of a buffer, one 64-byte block at a time
+typedef struct {
+        const char* block;
+        const char* end;
+        uint64_t structurals; // Not yet visited separators of the current block
+} _FastOsuParser__Scanner;
 
-                                                                i += content_size+1; // Skip to next line
+FASTOSUPARSER_DEF void _FastOsuParser__ScannerInit(_FastOsuParser__Scanner* scanner, const char* i, const char* end) {
 
-                                                        }
-                                                        break;
+        _FastOsuParser__BlockMasks masks;
+        _FastOsuParser__Classify(i, end, &masks);
 
-                                                }
+        scanner->block = i;
+        scanner->end = end;
+        scanner->structurals = masks.structural;
 
-                                        break;
+}
 
-                                        case 'A': // [A]rtist?
-                                        {
+// Returns the next separator ("end" if there are none left)
+FASTOSUPARSER_DEF const char* _FastOsuParser__ScannerNext(_FastOsuParser__Scanner* scanner) {
 
-                                                if (*(i+sizeof("rtist")) == 'U') break; // Skip if "ArtistUnicode"
+        while (scanner->structurals == 0) {
+                scanner->block += 64;
+                if (scanner->block >= scanner->end) {
+                        scanner->block = scanner->end;
+                        return scanner->end;
+                }
 
-                                                i += sizeof("rtist:"); // Skip to content
+                _FastOsuParser__BlockMasks masks;
+                _FastOsuParser__Classify(scanner->block, scanner->end, &masks);
+                scanner->structurals = masks.structural;
+        }
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
-                                                if (content_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_ARTIST_TOO_LONG;
+        const char* separator = scanner->block + _FastOsuParser__Ctz64(scanner->structurals);
+        scanner->structurals &= scanner->structurals-1;
 
-                                                memcpy(&out->artist, i, content_size);
-                                                out->artist_size = content_size;
+        return separator;
 
-                                                i += content_size+1; // Skip to next line
+}
 
-                                        }
-                                        break;
+// Counts the lines of [TimingPoints] & [HitObjects], and the '|' in [HitObjects] (upper bound of curve points & sliders),
+// so that a beatmap's arena can be sized before anything is parsed
+// (only for the sections in "flags", stops as soon as those are done)
+// "*section" is the one "i" is in (_FastOsuParser__SECTION_NONE at the start of a file), & becomes the one "end" is in, to continue from there
+FASTOSUPARSER_DEF void _FastOsuParser__CountSections(
+        const char* i,
+        const char* end,
+        int flags,
+        size_t* timing_points_count,
+        size_t* hit_objects_count,
+        size_t* curve_points_count,
+        _FastOsuParser__Section* section
+) {
 
-                                        case 'C': // [C]reator
-                                        {
+        _FastOsuParser__Section current_section = *section;
+        *section = _FastOsuParser__SECTION_NONE; // (once done)
 
-                                                i += sizeof("reator:"); // Skip to content
+        int remaining_sections = flags & (FastOsuParser__PARSE_TIMING_POINTS | FastOsuParser__PARSE_HIT_OBJECTS);
+        if (remaining_sections == 0) return;
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
-                                                if (content_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_CREATOR_TOO_LONG;
+        uint64_t previous_newline = 1; // "i" starts a line
 
-                                                memcpy(&out->creator, i, content_size);
-                                                out->creator_size = content_size;
+        for (; i < end; i += 64) {
 
-                                                i += content_size+1; // Skip to next line
+                _FastOsuParser__BlockMasks masks;
+                _FastOsuParser__Classify(i, end, &masks);
 
-                                        }
-                                        break;
+                uint64_t valid = (end-i < 64) ? (1ULL << (end-i)) - 1 : ~0ULL;
+                uint64_t line_starts = ((masks.newline << 1) | previous_newline) & valid;
+                previous_newline = masks.newline >> 63;
 
-                                        case 'V': // [V]ersion
-                                        {
+                uint64_t empty_lines = line_starts & (masks.newline | masks.carriage_return);
+                uint64_t content_lines = line_starts & ~empty_lines & ~masks.bracket;
 
-                                                i += sizeof("ersion:"); // Skip to content
+                // Count in between section changes (section headers & the empty line ending [TimingPoints])
+                uint64_t events = line_starts & (masks.bracket | empty_lines);
+                uint64_t from = ~0ULL; // Bits at/after the current position
+                for (;;) {
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
-                                                if (content_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_VERSION_TOO_LONG;
+                        uint64_t until = (events == 0) ? ~0ULL : (events & -events) - 1; // Bits before the next event
+                        uint64_t range = from & until;
 
-                                                memcpy(&out->version, i, content_size);
-                                                out->version_size = content_size;
+                        if (current_section == _FastOsuParser__SECTION_TIMING_POINTS) {
+                                *timing_points_count += _FastOsuParser__Popcount64(content_lines & range);
+                        }
+                        else if (current_section == _FastOsuParser__SECTION_HIT_OBJECTS) {
+                                *hit_objects_count += _FastOsuParser__Popcount64(content_lines & range);
+                                if (_FASTOSUPARSER_CURVE_POINTS_STORAGE(flags) || (flags & FastOsuParser__PARSE_COLUMNS)) *curve_points_count += _FastOsuParser__Popcount64(masks.pipe & range);
+                        }
 
-                                                i += content_size+1; // Skip to next line
+                        if (events == 0) break;
 
-                                        }
-                                        break;
+                        int event = _FastOsuParser__Ctz64(events);
+                        char b_new_section = (masks.bracket >> event) & 1;
+                        if (b_new_section || current_section == _FastOsuParser__SECTION_TIMING_POINTS) { // (an empty line ends [TimingPoints])
 
-                                        case 'B': // [B]eatmap...
+                                // Finished with the previous section
+                                if (current_section == _FastOsuParser__SECTION_TIMING_POINTS) remaining_sections &= ~FastOsuParser__PARSE_TIMING_POINTS;
+                                if (current_section == _FastOsuParser__SECTION_HIT_OBJECTS) remaining_sections &= ~FastOsuParser__PARSE_HIT_OBJECTS;
+                                if (remaining_sections == 0) return;
 
-                                                i += sizeof("eatmap"); // Skip to next unique letter
-                                                switch (*i) { // Check next unique letter (Beatmap[X]...)
+                                char first_letter = (b_new_section && i+event+1 < end) ? *(i+event+1) : '\0';
+                                if (first_letter == 'T' && (remaining_sections & FastOsuParser__PARSE_TIMING_POINTS)) current_section = _FastOsuParser__SECTION_TIMING_POINTS;
+                                else if (first_letter == 'H' && (remaining_sections & FastOsuParser__PARSE_HIT_OBJECTS)) current_section = _FastOsuParser__SECTION_HIT_OBJECTS;
+                                else current_section = _FastOsuParser__SECTION_NONE;
 
-                                                        case 'I': // Beatmap[I]D
-                                                        {
+                        }
 
-                                                                i += sizeof("D:"); // Skip to content
+                        from = ~until;
+                        events &= events-1;
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+                }
 
-                                                                out->beatmap_id = atoi(i);
+        }
 
-                                                                i += content_size+1; // Skip to next line
+        *section = current_section;
 
-                                                        }
-                                                        break;
+}
 
-                                                        case 'S': // Beatmap[S]etID
-                                                        {
+// Parses the [TimingPoints] line at "*i", leaving "*i" at the start of the next line
+FASTOSUPARSER_DEF void _FastOsuParser__ParseTimingPoint(const char** i_, _FastOsuParser__Scanner* scanner, const char* end, FastOsuParser__TimingPoint* timing_point) {
 
-                                                                i += sizeof("etID:"); // Skip to content
+        const char* i = *i_;
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+        // Get "time"
+        timing_point->time = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
 
-                                                                out->beatmap_set_id = atoi(i);
+        // Get "beatLength"
+        timing_point->beat_length = _FastOsuParser__ParseDouble(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
 
-                                                                i += content_size+1; // Skip to next line
+        // Get "meter"
+        timing_point->meter = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
 
-                                                        }
-                                                        break;
+#if defined(FASTOSUPARSER_TIMING_POINT_SAMPLES)
+        // Get "sampleSet", "sampleIndex", & "volume"
+        timing_point->sample_set = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        timing_point->sample_index = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        timing_point->volume = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+#else
+        // Skip "sampleSet", "sampleIndex", & "volume"
+        _FastOsuParser__ScannerNext(scanner);
+        _FastOsuParser__ScannerNext(scanner);
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+#endif
 
-                                                }
+        // Get "uninherited"
+        timing_point->b_uninherited = _FastOsuParser__ParseInt(&i);
 
-                                        break;
+#if defined(FASTOSUPARSER_TIMING_POINT_SAMPLES)
+        // Get "effects" (if the line has it)
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+        timing_point->effects = (*(i-1) == ',') ? _FastOsuParser__ParseInt(&i) : 0;
+#endif
 
-                                }
+        // Skip to next line
+        while (i < end && *(i-1) != '\n') i = _FastOsuParser__ScannerNext(scanner)+1;
 
-                        break;
+        *i_ = i;
 
+}
 
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
 
-                        case SECTION_DIFFICULTY:
+// Parses the "normalSet:additionSet:index:volume" of a "hitSample" at "i" (the file name is skipped with the rest of the line),
+// returns where the next value starts
+FASTOSUPARSER_DEF const char* _FastOsuParser__ParseHitSample(const char* i, _FastOsuParser__Scanner* scanner, FastOsuParser__HitObject* hit_object) {
 
-                                switch (*i) {
+        hit_object->normal_set = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+        if (*(i-1) != ':') return i;
 
-                                        case 'H': // [H]PDrainRate
-                                        {
+        hit_object->addition_set = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+        if (*(i-1) != ':') return i;
 
-                                                i += sizeof("PDrainRate:"); // Skip to content
+        hit_object->sample_index = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+        if (*(i-1) != ':') return i;
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
+        hit_object->volume = _FastOsuParser__ParseInt(&i);
+        return _FastOsuParser__ScannerNext(scanner)+1;
 
-                                                out->hp_drain_rate = atof(i);
+}
 
-                                                i += content_size+1; // Skip to next line
+// Parses a slider's "edgeSounds" & "edgeSets" at "i" (if it's after a ','), writing them from "*curve_points" (advanced past them) up to "curve_points_end",
+// returns where the next value starts
+FASTOSUPARSER_DEF const char* _FastOsuParser__ParseEdgeSounds(const char* i, _FastOsuParser__Scanner* scanner, FastOsuParser__HitObject* hit_object, FastOsuParser__CurvePoint** curve_points, FastOsuParser__CurvePoint* curve_points_end) {
+
+        hit_object->object_params.edge_sounds_count = 0;
+        if (*(i-1) != ',') return i;
+
+        // Right after the slider's curve points (if there's room, "edgeSounds" & "edgeSets" have a '|' per edge but one, so there always is unless the line is malformed)
+        FastOsuParser__EdgeSound* edge_sounds = (curve_points == NULL) ? NULL : (FastOsuParser__EdgeSound*)*curve_points;
+        FastOsuParser__EdgeSound* edge_sounds_end = (FastOsuParser__EdgeSound*)curve_points_end;
+        if (hit_object->object_params.curve_points == NULL) hit_object->object_params.curve_points = (FastOsuParser__CurvePoint*)edge_sounds; // (count stays 0, see FastOsuParser__EdgeSounds())
+
+        // Get "edgeSounds"
+        int count = 0;
+        for (;;) {
+                int hit_sound = _FastOsuParser__ParseInt(&i);
+                if (edge_sounds != NULL && edge_sounds + count < edge_sounds_end) {
+                        memset(&edge_sounds[count], 0, sizeof(edge_sounds[count]));
+                        edge_sounds[count].hit_sound = hit_sound;
+                        count++;
+                }
+                i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next sound ('|') or "edgeSets" (',')
+                if (*(i-1) != '|') break;
+        }
+        hit_object->object_params.edge_sounds_count = count;
+        if (edge_sounds != NULL) *curve_points = (FastOsuParser__CurvePoint*)(edge_sounds + count);
+
+        // Get "edgeSets"
+        if (*(i-1) != ',') return i;
+        for (int edge = 0;; edge++) {
+                int normal_set = _FastOsuParser__ParseInt(&i);
+                i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to "additionSet"
+                int addition_set = 0;
+                if (*(i-1) == ':') {
+                        addition_set = _FastOsuParser__ParseInt(&i);
+                        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next set ('|') or "hitSample" (',')
+                }
+                if (edge < count) {
+                        edge_sounds[edge].normal_set = normal_set;
+                        edge_sounds[edge].addition_set = addition_set;
+                }
+                if (*(i-1) != '|') break;
+        }
 
-                                        }
-                                        break;
+        return i;
 
-                                        case 'C': // [C]ircleSize
-                                        {
+}
 
-                                                i += sizeof("ircleSize:"); // Skip to content
+// Edge sounds of a slider (FASTOSUPARSER_HIT_SOUNDS, "object_params.edge_sounds_count" of them), stored right after its curve points
+// (for a cache view, see FastOsuParser__CacheEdgeSounds())
+FASTOSUPARSER_DEF const FastOsuParser__EdgeSound* FastOsuParser__EdgeSounds(const FastOsuParser__CurvePoint* curve_points, const FastOsuParser__HitObject* hit_object) {
+        return (const FastOsuParser__EdgeSound*)(curve_points + hit_object->object_params.curve_points_count);
+}
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
+#endif
 
-                                                out->circle_size = atof(i);
+// Entries of the curve point array used by the slider "hit_object" (its curve points, then its edge sounds with FASTOSUPARSER_HIT_SOUNDS)
+FASTOSUPARSER_DEF size_t _FastOsuParser__CurvePointsStorage(const FastOsuParser__HitObject* hit_object) {
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        return hit_object->object_params.curve_points_count + hit_object->object_params.edge_sounds_count;
+#else
+        return hit_object->object_params.curve_points_count;
+#endif
+}
 
-                                                i += content_size+1; // Skip to next line
+// Parses the [HitObjects] line at "*i", leaving "*i" at the start of the next line
+// Curve points are written from "*curve_points" (advanced past them) up to "curve_points_end"
+// Nothing is read past the line's '\n': the values a cut off line doesn't have are 0 (so the next line is parsed the same wherever the buffer is split)
+FASTOSUPARSER_DEF void _FastOsuParser__ParseHitObject(const char** i_, _FastOsuParser__Scanner* scanner, const char* end, int flags, FastOsuParser__HitObject* hit_object, FastOsuParser__CurvePoint** curve_points, FastOsuParser__CurvePoint* curve_points_end) {
+
+        const char* i = *i_;
+
+        // Get "x"
+        hit_object->x = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        if (*(i-1) == '\n') goto _FastOsuParser__ParseHitObject_CUT_X;
+
+        // Get "y"
+        hit_object->y = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        if (*(i-1) == '\n') goto _FastOsuParser__ParseHitObject_CUT_Y;
+
+        // Get "time"
+        hit_object->time = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        if (*(i-1) == '\n') goto _FastOsuParser__ParseHitObject_CUT_TIME;
+
+        // Get "type"
+        hit_object->type = _FastOsuParser__ParseInt(&i);
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+        if (*(i-1) == '\n') goto _FastOsuParser__ParseHitObject_CUT_TYPE;
+
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        // Get "hitSound"
+        hit_object->hit_sound = _FastOsuParser__ParseInt(&i);
+        hit_object->normal_set = 0;
+        hit_object->addition_set = 0;
+        hit_object->volume = 0;
+        hit_object->sample_index = 0;
+        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+#else
+        // Skip "hitSound"
+        i = _FastOsuParser__ScannerNext(scanner)+1;
+#endif
+
+        // Get objectParams if slider or spinner
+        if (*(i-1) == ',') {
+                // Slider
+                if (hit_object->type & 0b00000010) {
+
+                        hit_object->object_params.length = 0; // (if the line is cut off before it)
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        hit_object->object_params.edge_sounds_count = 0;
+#endif
+
+                        // Get "curveType"
+                        hit_object->object_params.curve_type = *i;
+                        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+
+                        // Get "curvePoints"
+                        if (!(flags & FastOsuParser__PARSE_CURVE_POINTS)) {
+                                hit_object->object_params.curve_points = NULL;
+                                hit_object->object_params.curve_points_count = 0;
+                                while (i < end && *(i-1) != ',' && *(i-1) != '\n') i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to "slides"
+                        }
+                        else {
+                                FastOsuParser__CurvePoint* curve_point = *curve_points;
+                                hit_object->object_params.curve_points = curve_point;
+                                while (curve_point < curve_points_end && *(i-1) != '\n') {
 
-                                        }
-                                        break;
+                                        // Get curvePoint x
+                                        curve_point->x = _FastOsuParser__ParseInt(&i);
+                                        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next y
+                                        if (*(i-1) == '\n') break; // (no y, not a point)
 
-                                        case 'O': // [O]verallDifficulty
-                                        {
+                                        // Get curvePoint y
+                                        curve_point->y = _FastOsuParser__ParseInt(&i);
+                                        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next x ('|') or "slides" (',')
 
-                                                i += sizeof("verallDifficulty:"); // Skip to content
+                                        curve_point++;
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
+                                        if (*(i-1) != '|') break;
+                                }
+                                hit_object->object_params.curve_points_count = curve_point - hit_object->object_params.curve_points;
+                                *curve_points = curve_point;
+                        }
 
-                                                out->overall_difficulty = atof(i);
+                        // Get "slides"
+                        if (*(i-1) == '\n') { // (cut off in its curve points)
+                                hit_object->object_params.slides = 0;
+                                goto _FastOsuParser__ParseHitObject_END;
+                        }
+                        hit_object->object_params.slides = _FastOsuParser__ParseInt(&i);
+                        i = _FastOsuParser__ScannerNext(scanner)+1; // Skip to next value
+                        if (*(i-1) == '\n') goto _FastOsuParser__ParseHitObject_END;
+
+                        // Get "length"
+                        hit_object->object_params.length = _FastOsuParser__ParseDouble(&i);
+
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        // Get "edgeSounds", "edgeSets" & "hitSample"
+                        i = _FastOsuParser__ScannerNext(scanner)+1;
+                        i = _FastOsuParser__ParseEdgeSounds(i, scanner, hit_object, curve_points, curve_points_end);
+                        if (*(i-1) == ',') i = _FastOsuParser__ParseHitSample(i, scanner, hit_object);
+#else
+                        // Implicit "edgeSets" skip
+#endif
 
-                                                i += content_size+1; // Skip to next line
+                }
 
-                                        }
-                                        break;
+                // Spinner
+                else if (hit_object->type & 0b00001000) {
 
-                                        case 'A': // [A]pproachRate
-                                        {
+                        // Get "endTime"
+                        hit_object->object_params.end_time = _FastOsuParser__ParseInt(&i);
 
-                                                i += sizeof("pproachRate:"); // Skip to content
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        // Get "hitSample"
+                        i = _FastOsuParser__ScannerNext(scanner)+1;
+                        if (*(i-1) == ',') i = _FastOsuParser__ParseHitSample(i, scanner, hit_object);
+#endif
 
-                                                size_t content_size = 0;
-                                                while (*(i+content_size) != '\r') content_size++;
+                }
 
-                                                out->approach_rate = atof(i);
+#if defined(FASTOSUPARSER_HOLD_NOTES)
+                // Hold note (osu!mania)
+                else if (hit_object->type & 0b10000000) {
 
-                                                i += content_size+1; // Skip to next line
+                        // Get "endTime"
+                        hit_object->object_params.end_time = _FastOsuParser__ParseInt(&i);
 
-                                        }
-                                        break;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        // Get "hitSample" (after a ':' for hold notes)
+                        i = _FastOsuParser__ScannerNext(scanner)+1;
+                        if (*(i-1) == ':') i = _FastOsuParser__ParseHitSample(i, scanner, hit_object);
+#endif
 
-                                        case 'S': // [S]lider...?
+                }
+#endif
 
-                                                i += sizeof("lider"); // Skip to next unique letter
-                                                switch (*i) {
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                // Circle (or hold note without FASTOSUPARSER_HOLD_NOTES, its "endTime" is where "normalSet" would be)
+                else if (!(hit_object->type & 0b10000000)) {
 
-                                                        case 'M': // Slider[M]ultiplier
-                                                        {
+                        // Get "hitSample"
+                        i = _FastOsuParser__ParseHitSample(i, scanner, hit_object);
 
-                                                                i += sizeof("ultiplier:"); // Skip to content
+                }
+#endif
+        }
+        else memset(&hit_object->object_params, 0, sizeof(hit_object->object_params)); // (cut off line, no dangling "curve_points")
+
+        // Skip to next line
+        while (i < end && *(i-1) != '\n') i = _FastOsuParser__ScannerNext(scanner)+1;
+
+_FastOsuParser__ParseHitObject_END:
+        *i_ = i;
+        return;
+
+        // Line cut off before its "hitSound" (already at the next line)
+_FastOsuParser__ParseHitObject_CUT_X:
+        hit_object->y = 0;
+_FastOsuParser__ParseHitObject_CUT_Y:
+        hit_object->time = 0;
+_FastOsuParser__ParseHitObject_CUT_TIME:
+        hit_object->type = 0;
+_FastOsuParser__ParseHitObject_CUT_TYPE:
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        hit_object->hit_sound = 0;
+        hit_object->normal_set = 0;
+        hit_object->addition_set = 0;
+        hit_object->volume = 0;
+        hit_object->sample_index = 0;
+#endif
+        memset(&hit_object->object_params, 0, sizeof(hit_object->object_params));
+        *i_ = i;
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+}
 
-                                                                out->slider_multiplier = atof(i);
+#if defined(FASTOSUPARSER_STRING_POOL)
 
-                                                                i += content_size+1; // Skip to next line
+FASTOSUPARSER_DEF void FastOsuParser__StringPoolInit(FastOsuParser__StringPool* pool) {
 
-                                                        }
-                                                        break;
+        memset(pool, 0, sizeof(*pool));
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexInit(&pool->mutex);
+#endif
 
-                                                        case 'T': // Slider[T]ickRate
-                                                        {
+}
 
-                                                                i += sizeof("ickRate:"); // Skip to content
+// (views into it are meaningless afterwards)
+FASTOSUPARSER_DEF void FastOsuParser__StringPoolFree(FastOsuParser__StringPool* pool) {
 
-                                                                size_t content_size = 0;
-                                                                while (*(i+content_size) != '\r') content_size++;
+        free(pool->data);
+        free(pool->slots);
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexDestroy(&pool->mutex);
+#endif
 
-                                                                out->slider_tick_rate = atof(i);
+        memset(pool, 0, sizeof(*pool));
 
-                                                                i += content_size+1; // Skip to next line
+}
 
-                                                        }
-                                                        break;
+// NUL-terminated contents of "view", valid until the next string is added to "pool" (its storage moves as it grows)
+FASTOSUPARSER_DEF const char* FastOsuParser__String(const FastOsuParser__StringPool* pool, FastOsuParser__StringView view) {
+        return (view.size == 0) ? "" : pool->data + view.offset;
+}
 
-                                                }
+// FNV-1a (metadata strings are short, so this beats setting up XXH64)
+FASTOSUPARSER_DEF uint32_t _FastOsuParser__StringHash(const char* string, size_t size) {
 
-                                        break;
+        uint32_t hash = 2166136261u;
+        for (size_t n = 0; n < size; n++) hash = (hash ^ (unsigned char)string[n]) * 16777619u;
 
-                                }
+        return hash;
 
-                        break;
+}
 
+// Points "*out" at the copy of "string" in "pool", adding it if it's not there yet
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__Intern(FastOsuParser__StringPool* pool, const char* string, size_t size, FastOsuParser__StringView* out) {
+
+        out->offset = 0;
+        out->size = 0;
+        if (size == 0) return FastOsuParser__SUCCESS;
+
+        uint32_t hash = _FastOsuParser__StringHash(string, size);
+        FastOsuParser__Error error = FastOsuParser__SUCCESS;
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexLock(&pool->mutex);
+#endif
+
+        // Keep the table at most half full
+        if (2 * (pool->strings_count+1) > ((pool->slots == NULL) ? 0 : pool->slots_mask+1)) {
+                size_t new_slots_count = (pool->slots == NULL) ? 64 : 2 * (pool->slots_mask+1);
+                FastOsuParser__StringView* new_slots = (FastOsuParser__StringView*)calloc(new_slots_count, sizeof(FastOsuParser__StringView));
+                if (new_slots == NULL) error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                else {
+                        for (size_t n = 0; pool->slots != NULL && n <= pool->slots_mask; n++) {
+                                FastOsuParser__StringView slot = pool->slots[n];
+                                if (slot.size == 0) continue;
+                                size_t s = _FastOsuParser__StringHash(pool->data + slot.offset, slot.size) & (new_slots_count-1);
+                                while (new_slots[s].size != 0) s = (s+1) & (new_slots_count-1);
+                                new_slots[s] = slot;
+                        }
+                        free(pool->slots);
+                        pool->slots = new_slots;
+                        pool->slots_mask = new_slots_count-1;
+                }
+        }
 
+        if (error == FastOsuParser__SUCCESS) {
+                size_t s = hash & pool->slots_mask;
+                while (pool->slots[s].size != 0 && (pool->slots[s].size != size || memcmp(pool->data + pool->slots[s].offset, string, size) != 0)) s = (s+1) & pool->slots_mask;
+
+                if (pool->slots[s].size == 0) { // New string, append it (NUL-terminated)
+                        if (size+1 > UINT32_MAX - pool->size) error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY; // (offsets are 32-bit)
+                        else if (pool->size + size+1 > pool->capacity) {
+                                size_t new_capacity = (pool->capacity == 0) ? 4096 : pool->capacity * 2;
+                                while (new_capacity < pool->size + size+1) new_capacity *= 2;
+                                char* new_data = (char*)realloc(pool->data, new_capacity);
+                                if (new_data == NULL) error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                                else {
+                                        pool->data = new_data;
+                                        pool->capacity = new_capacity;
+                                }
+                        }
 
-                        case SECTION_TIMING_POINTS:
+                        if (error == FastOsuParser__SUCCESS) {
+                                memcpy(pool->data + pool->size, string, size);
+                                pool->data[pool->size + size] = '\0';
+                                pool->slots[s].offset = pool->size;
+                                pool->slots[s].size = size;
+                                pool->size += size+1;
+                                pool->strings_count++;
+                        }
+                }
 
-                                size_t timing_points_count = 0;
-                                for ( // Loop until "\n\r" pattern (two new lines back-to-back)
-                                        int line_offset = 0;
-                                        *(i+line_offset) != '\r';
-                                        line_offset++
-                                ) {
-                                        while (*(i+line_offset) != '\n') line_offset++;
-                                        timing_points_count++;
-                                }
+                if (error == FastOsuParser__SUCCESS) *out = pool->slots[s];
+        }
 
-                                out->timing_points = malloc(sizeof(*(out->timing_points)) * timing_points_count);
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexUnlock(&pool->mutex);
+#endif
 
-                                for (int tp = 0; tp < timing_points_count; tp++) {
+        return error;
 
-                                        // Get "time"
-                                        out->timing_points[tp].time = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+}
 
-                                        // Get "beatLength"
-                                        out->timing_points[tp].beat_length = atof(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+// Interns a string value into "*field" (left empty without a "string_pool")
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ParseString(const char* value, size_t value_size, FastOsuParser__Beatmap* out, FastOsuParser__StringView* field) {
 
-                                        // Get "meter"
-                                        out->timing_points[tp].meter = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+        if (out->string_pool == NULL) return FastOsuParser__SUCCESS;
 
-                                        // Skip "sampleSet", "sampleIndex", & "volume"
-                                        while (*i != ',') i++; i++;
-                                        while (*i != ',') i++; i++;
-                                        while (*i != ',') i++; i++;
+        return _FastOsuParser__Intern(out->string_pool, value, value_size, field);
 
-                                        // Get "uninherited"
-                                        out->timing_points[tp].b_uninherited = atoi(i);
+}
 
-                                        // Skip to next line
-                                        while (*i != '\n') i++;
-                                        i++;
+#endif
 
-                                }
+// Every key of [General], [Editor], [Metadata], [Difficulty] & [Colours] (the ones without a beatmap field are recognized & skipped)
+typedef enum {
+        _FastOsuParser__KEY_UNKNOWN,
+
+        // [General]
+        _FastOsuParser__KEY_AUDIO_FILENAME,
+        _FastOsuParser__KEY_AUDIO_LEAD_IN,
+        _FastOsuParser__KEY_AUDIO_HASH,
+        _FastOsuParser__KEY_PREVIEW_TIME,
+        _FastOsuParser__KEY_COUNTDOWN,
+        _FastOsuParser__KEY_SAMPLE_SET,
+        _FastOsuParser__KEY_STACK_LENIENCY,
+        _FastOsuParser__KEY_MODE,
+        _FastOsuParser__KEY_LETTERBOX_IN_BREAKS,
+        _FastOsuParser__KEY_STORY_FIRE_IN_FRONT,
+        _FastOsuParser__KEY_USE_SKIN_SPRITES,
+        _FastOsuParser__KEY_ALWAYS_SHOW_PLAYFIELD,
+        _FastOsuParser__KEY_OVERLAY_POSITION,
+        _FastOsuParser__KEY_SKIN_PREFERENCE,
+        _FastOsuParser__KEY_EPILEPSY_WARNING,
+        _FastOsuParser__KEY_COUNTDOWN_OFFSET,
+        _FastOsuParser__KEY_SPECIAL_STYLE,
+        _FastOsuParser__KEY_WIDESCREEN_STORYBOARD,
+        _FastOsuParser__KEY_SAMPLES_MATCH_PLAYBACK_RATE,
+
+        // [Editor]
+        _FastOsuParser__KEY_BOOKMARKS,
+        _FastOsuParser__KEY_DISTANCE_SPACING,
+        _FastOsuParser__KEY_BEAT_DIVISOR,
+        _FastOsuParser__KEY_GRID_SIZE,
+        _FastOsuParser__KEY_TIMELINE_ZOOM,
+
+        // [Metadata]
+        _FastOsuParser__KEY_TITLE,
+        _FastOsuParser__KEY_TITLE_UNICODE,
+        _FastOsuParser__KEY_ARTIST,
+        _FastOsuParser__KEY_ARTIST_UNICODE,
+        _FastOsuParser__KEY_CREATOR,
+        _FastOsuParser__KEY_VERSION,
+        _FastOsuParser__KEY_SOURCE,
+        _FastOsuParser__KEY_TAGS,
+        _FastOsuParser__KEY_BEATMAP_ID,
+        _FastOsuParser__KEY_BEATMAP_SET_ID,
+
+        // [Difficulty]
+        _FastOsuParser__KEY_HP_DRAIN_RATE,
+        _FastOsuParser__KEY_CIRCLE_SIZE,
+        _FastOsuParser__KEY_OVERALL_DIFFICULTY,
+        _FastOsuParser__KEY_APPROACH_RATE,
+        _FastOsuParser__KEY_SLIDER_MULTIPLIER,
+        _FastOsuParser__KEY_SLIDER_TICK_RATE,
+
+        // [Colours]
+        _FastOsuParser__KEY_COMBO_1,
+        _FastOsuParser__KEY_COMBO_2,
+        _FastOsuParser__KEY_COMBO_3,
+        _FastOsuParser__KEY_COMBO_4,
+        _FastOsuParser__KEY_COMBO_5,
+        _FastOsuParser__KEY_COMBO_6,
+        _FastOsuParser__KEY_COMBO_7,
+        _FastOsuParser__KEY_COMBO_8,
+        _FastOsuParser__KEY_SLIDER_TRACK_OVERRIDE,
+        _FastOsuParser__KEY_SLIDER_BORDER,
+
+        _FastOsuParser__KEYS_COUNT
+} _FastOsuParser__Key;
+
+static const char _FastOsuParser__KEY_NAMES[_FastOsuParser__KEYS_COUNT][32] = { // (longer than the longest one, so that a name can be compared 16 bytes at a time)
+        "",
+        "AudioFilename", "AudioLeadIn", "AudioHash", "PreviewTime", "Countdown", "SampleSet", "StackLeniency", "Mode", "LetterboxInBreaks", "StoryFireInFront", "UseSkinSprites", "AlwaysShowPlayfield", "OverlayPosition", "SkinPreference", "EpilepsyWarning", "CountdownOffset", "SpecialStyle", "WidescreenStoryboard", "SamplesMatchPlaybackRate",
+        "Bookmarks", "DistanceSpacing", "BeatDivisor", "GridSize", "TimelineZoom",
+        "Title", "TitleUnicode", "Artist", "ArtistUnicode", "Creator", "Version", "Source", "Tags", "BeatmapID", "BeatmapSetID",
+        "HPDrainRate", "CircleSize", "OverallDifficulty", "ApproachRate", "SliderMultiplier", "SliderTickRate",
+        "Combo1", "Combo2", "Combo3", "Combo4", "Combo5", "Combo6", "Combo7", "Combo8", "SliderTrackOverride", "SliderBorder"
+};
+
+// Key in each slot of the perfect hash (generated from _FastOsuParser__KEY_NAMES with _FastOsuParser__KeyHash() by tools/gen_key_slots.py, no two keys share a slot)
+static const unsigned char _FastOsuParser__KEY_SLOTS[128] = {
+        11, 0, 0, 13, 0, 0, 0, 0, 47, 0, 0, 34, 0, 0, 43, 30,
+        0, 0, 0, 5, 17, 0, 0, 37, 10, 0, 0, 0, 0, 25, 36, 0,
+        8, 35, 0, 32, 0, 7, 0, 0, 27, 46, 0, 0, 40, 0, 1, 0,
+        42, 21, 0, 0, 0, 0, 0, 22, 29, 0, 4, 3, 19, 0, 0, 38,
+        33, 0, 18, 31, 0, 23, 0, 0, 0, 0, 12, 45, 0, 0, 6, 0,
+        0, 0, 41, 0, 0, 0, 0, 0, 0, 15, 9, 0, 0, 16, 0, 0,
+        0, 0, 0, 0, 0, 20, 48, 0, 24, 0, 0, 0, 0, 44, 50, 0,
+        14, 0, 0, 0, 0, 0, 26, 2, 0, 0, 28, 0, 39, 49, 0, 0
+};
+
+// Perfect hash of a key, by its first two & last letters & its length (the multiplier is the first random odd one that gave every known key its own slot, tools/gen_key_slots.py looks for a new one if they stop fitting)
+FASTOSUPARSER_DEF unsigned int _FastOsuParser__KeyHash(const char* key, size_t key_size) {
+
+        uint32_t x = (uint32_t)(unsigned char)key[0] | (uint32_t)(unsigned char)key[1] << 8 | (uint32_t)(unsigned char)key[key_size-1] << 16 | (uint32_t)key_size << 24;
+        return (uint32_t)(x * 0x0977BC87u) >> 25;
 
-                                out->timing_points_count = timing_points_count;
+}
 
-                                current_section = SECTION_NONE; // Finished with this section
+// Whether "key" is exactly the known key "name" (whose row is 32 bytes, and "key" is followed by at least as many bytes of the line or padding)
+FASTOSUPARSER_DEF char _FastOsuParser__KeyEquals(const char* name, const char* key, size_t key_size) {
 
-                        break;
+        if (name[key_size] != '\0') return 0;
 
+#if defined(_FASTOSUPARSER_X86)
+        uint32_t same = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)name), _mm_loadu_si128((const __m128i*)key)))
+                | (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)(name+16)), _mm_loadu_si128((const __m128i*)(key+16)))) << 16;
+        uint32_t needed = ((uint32_t)1 << key_size) - 1; // (key_size < 32, longer keys are never looked up)
+        return (same & needed) == needed;
+#else
+        return memcmp(name, key, key_size) == 0;
+#endif
+
+}
 
+// First '\r' or '\n' (or ':' too with "b_colon") at/after "i", which is always found in the padding at the latest
+// (so on x86, 16 bytes at a time: none of these loads can go further than the padding)
+FASTOSUPARSER_DEF const char* _FastOsuParser__FindLineEnd(const char* i, char b_colon) {
+
+#if defined(_FASTOSUPARSER_X86)
+        const __m128i colon = b_colon ? _mm_set1_epi8(':') : _mm_set1_epi8('\n');
+        for (;; i += 16) {
+                __m128i bytes = _mm_loadu_si128((const __m128i*)i);
+                __m128i ends = _mm_or_si128(
+                        _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('\r')), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n'))),
+                        _mm_cmpeq_epi8(bytes, colon)
+                );
+                int mask = _mm_movemask_epi8(ends);
+                if (mask != 0) return i + __builtin_ctz(mask);
+        }
+#else
+        while (*i != '\r' && *i != '\n' && !(b_colon && *i == ':')) i++;
+        return i;
+#endif
 
-                        case SECTION_HIT_OBJECTS: // Assumed that [HitObjects] is the last section in the file
+}
 
-                                size_t hit_objects_count = 0;
-                                for ( // Loop until EOF
-                                        int line_offset = 0;
-                                        line_offset < beatmap_file_size-(i-beatmap_file_contents);
-                                        line_offset++
-                                ) {
-                                        while (*(i+line_offset) != '\n') line_offset++;
-                                        hit_objects_count++;
-                                }
+// Size of the value at "i", up to the end of its line ('\r' or '\n') & without trailing spaces
+FASTOSUPARSER_DEF size_t _FastOsuParser__ValueSize(const char* i) {
 
-                                out->hit_objects = malloc(sizeof(*(out->hit_objects)) * hit_objects_count);
+        const char* end = _FastOsuParser__FindLineEnd(i, 0);
+        while (end > i && *(end-1) == ' ') end--;
 
-                                for (int ho = 0; ho < hit_objects_count; ho++) {
+        return end - i;
 
-                                        size_t content_size;
+}
 
-                                        // Get "x"
-                                        out->hit_objects[ho].x = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+// Parses a "Key: Value" line of [General], [Metadata] or [Difficulty] (CRLF or LF, any spaces around the key & value)
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ParseKeyValue(const char* i, FastOsuParser__Beatmap* out) {
 
-                                        // Get "y"
-                                        out->hit_objects[ho].y = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+        // Split the line at its ':'
+        while (*i == ' ') i++;
+        const char* key = i;
+        i = _FastOsuParser__FindLineEnd(i, 1);
+        if (*i != ':') return FastOsuParser__SUCCESS; // Not a key/value line
 
-                                        // Get "time"
-                                        out->hit_objects[ho].time = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+        size_t key_size = i - key;
+        while (key_size != 0 && key[key_size-1] == ' ') key_size--;
+        if (key_size == 0 || key_size >= sizeof(_FastOsuParser__KEY_NAMES[0])) return FastOsuParser__SUCCESS;
 
-                                        // Get "type"
-                                        out->hit_objects[ho].type = atoi(i);
-                                        while (*i != ',') i++; i++; // Skip to next value
+        const char* value = i+1;
+        while (*value == ' ') value++;
 
-                                        // Skip "hitSound"
-                                        while (*i != ',') i++; i++;
+        // Look it up (a slot's key has to match exactly, anything else is an unknown key)
+        unsigned char known_key = _FastOsuParser__KEY_SLOTS[_FastOsuParser__KeyHash(key, key_size)];
+        if (!_FastOsuParser__KeyEquals(_FastOsuParser__KEY_NAMES[known_key], key, key_size)) return FastOsuParser__SUCCESS;
 
-                                        // Get objectParams if slider or spinner
-                                        {
-                                                // Slider
-                                                if (out->hit_objects[ho].type & 0b00000010) {
+        switch (known_key) {
 
-                                                        // Get "curveType"
-                                                        out->hit_objects[ho].object_params.curve_type = *i;
-                                                        i += 2; // Skip to next value
+                // [General]
+                case _FastOsuParser__KEY_AUDIO_FILENAME:
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->audio_file_name);
+#else
+                {
+                        size_t value_size = _FastOsuParser__ValueSize(value);
+                        if (value_size > 255) return FastOsuParser__ERROR_SECTION_GENERAL_AUDIOFILENAME_TOO_LONG;
 
-                                                        // Get "curvePoints"
-                                                        {
-                                                                size_t curve_points_count = 0;
-                                                                size_t content_size = 0;
-                                                                for (
-                                                                        ;
-                                                                        *(i+content_size) != ',';
-                                                                        content_size++
-                                                                ) if (*(i+content_size) == ':') curve_points_count++;
+                        memcpy(&out->audio_file_name, value, value_size);
+                        out->audio_file_name_size = value_size;
+                }
+                break;
+#endif
+                case _FastOsuParser__KEY_AUDIO_LEAD_IN: out->audio_lead_in = _FastOsuParser__ParseInt(&value); break;
+                case _FastOsuParser__KEY_COUNTDOWN: out->countdown = _FastOsuParser__ParseInt(&value); break;
+                case _FastOsuParser__KEY_STACK_LENIENCY: out->stack_leniency = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_MODE: out->mode = _FastOsuParser__ParseInt(&value); break;
+                case _FastOsuParser__KEY_COUNTDOWN_OFFSET: out->countdown_offset = _FastOsuParser__ParseInt(&value); break;
+
+                // [Metadata]
+                case _FastOsuParser__KEY_TITLE:
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->title);
+#else
+                {
+                        size_t value_size = _FastOsuParser__ValueSize(value);
+                        if (value_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_TITLE_TOO_LONG;
+
+                        memcpy(&out->title, value, value_size);
+                        out->title_size = value_size;
+                }
+                break;
+#endif
+#if defined(FASTOSUPARSER_STRING_POOL)
+                case _FastOsuParser__KEY_TITLE_UNICODE: return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->title_unicode);
+#endif
+                case _FastOsuParser__KEY_ARTIST:
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->artist);
+#else
+                {
+                        size_t value_size = _FastOsuParser__ValueSize(value);
+                        if (value_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_ARTIST_TOO_LONG;
+
+                        memcpy(&out->artist, value, value_size);
+                        out->artist_size = value_size;
+                }
+                break;
+#endif
+#if defined(FASTOSUPARSER_STRING_POOL)
+                case _FastOsuParser__KEY_ARTIST_UNICODE: return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->artist_unicode);
+#endif
+                case _FastOsuParser__KEY_CREATOR:
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->creator);
+#else
+                {
+                        size_t value_size = _FastOsuParser__ValueSize(value);
+                        if (value_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_CREATOR_TOO_LONG;
+
+                        memcpy(&out->creator, value, value_size);
+                        out->creator_size = value_size;
+                }
+                break;
+#endif
+                case _FastOsuParser__KEY_VERSION:
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->version);
+#else
+                {
+                        size_t value_size = _FastOsuParser__ValueSize(value);
+                        if (value_size > 255) return FastOsuParser__ERROR_SECTION_METADATA_VERSION_TOO_LONG;
+
+                        memcpy(&out->version, value, value_size);
+                        out->version_size = value_size;
+                }
+                break;
+#endif
+#if defined(FASTOSUPARSER_STRING_POOL)
+                case _FastOsuParser__KEY_SOURCE: return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->source);
+#endif
+#if defined(FASTOSUPARSER_STRING_POOL)
+                case _FastOsuParser__KEY_TAGS: return _FastOsuParser__ParseString(value, _FastOsuParser__ValueSize(value), out, &out->tags);
+#endif
+                case _FastOsuParser__KEY_BEATMAP_ID: out->beatmap_id = _FastOsuParser__ParseInt(&value); break;
+                case _FastOsuParser__KEY_BEATMAP_SET_ID: out->beatmap_set_id = _FastOsuParser__ParseInt(&value); break;
+
+                // [Difficulty]
+                case _FastOsuParser__KEY_HP_DRAIN_RATE: out->hp_drain_rate = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_CIRCLE_SIZE: out->circle_size = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_OVERALL_DIFFICULTY: out->overall_difficulty = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_APPROACH_RATE: out->approach_rate = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_SLIDER_MULTIPLIER: out->slider_multiplier = _FastOsuParser__ParseDouble(&value); break;
+                case _FastOsuParser__KEY_SLIDER_TICK_RATE: out->slider_tick_rate = _FastOsuParser__ParseDouble(&value); break;
+
+                default: break; // (known, but the beatmap has no field for it)
 
-                                                                out->hit_objects[ho].object_params.curve_points = malloc(sizeof(*(out->hit_objects[ho].object_params.curve_points)) * curve_points_count);
+        }
 
-                                                                // For freeing in FastOsuParser__Free()
-                                                                out->_total_curve_points_count++; // *refers to allocated memory blocks... TODO: Better name
-                                                                out->_total_curve_points = realloc(out->_total_curve_points, sizeof(void*) * out->_total_curve_points_count);
-                                                                out->_total_curve_points[out->_total_curve_points_count-1] = out->hit_objects[ho].object_params.curve_points;
+        return FastOsuParser__SUCCESS;
 
-                                                                for (int cp = 0; cp < curve_points_count; cp++) {
+}
 
-                                                                        // Get curvePoint x
-                                                                        out->hit_objects[ho].object_params.curve_points[cp].x = atoi(i);
+// Parses a line of [Events] (only break periods, "2,start,end" or "Break,start,end", for FastOsuParser__PARSE_STATS)
+FASTOSUPARSER_DEF void _FastOsuParser__ParseEvent(const char* i, FastOsuParser__Beatmap* out) {
 
-                                                                        while (isdigit(*i)) i++; i++; // Skip to next y
+        if (*i == '2' && *(i+1) == ',') i += sizeof("2");
+        else if (*i == 'B' && *(i+1) == 'r' && *(i+2) == 'e' && *(i+3) == 'a' && *(i+4) == 'k' && *(i+5) == ',') i += sizeof("Break");
+        else return;
 
-                                                                        // Get curvePoint y
-                                                                        out->hit_objects[ho].object_params.curve_points[cp].y = atoi(i);
+        int start_time = _FastOsuParser__ParseInt(&i);
+        if (*i != ',') return;
+        i++;
+        int end_time = _FastOsuParser__ParseInt(&i);
 
-                                                                        while (isdigit(*i)) i++; i++; // Skip to next x
-                                                                }
+        out->stats.breaks_count++;
+        if (end_time > start_time) out->stats.breaks_length += end_time - start_time;
 
-                                                                out->hit_objects[ho].object_params.curve_points_count = curve_points_count;
-                                                        }
+}
 
-                                                        // Get "slides"
-                                                        out->hit_objects[ho].object_params.slides = atoi(i);
-                                                        while (*i != ',') i++; i++; // Skip to next value
+// Last timing point at/before "time" in the sorted "timing_points" (-1 if none)
+FASTOSUPARSER_DEF ptrdiff_t _FastOsuParser__TimingPointAt(const FastOsuParser__Beatmap* beatmap, double time) {
 
-                                                        // Get "length"
-                                                        out->hit_objects[ho].object_params.length = atof(i);
+        size_t begin = 0;
+        size_t end = beatmap->timing_points_count;
+        while (begin < end) { // First one after "time"
+                size_t middle = begin + (end - begin) / 2;
+                if (beatmap->timing_points[middle].time <= time) begin = middle+1;
+                else end = middle;
+        }
 
-                                                        // Implicit "edgeSets" skip
+        return (ptrdiff_t)begin - 1;
 
-                                                }
+}
 
-                                                // Spinner
-                                                else if (out->hit_objects[ho].type & 0b00001000) {
+// Timing in effect at "time" (ms), O(log n) with FastOsuParser__PARSE_TIMING_INDEX (else it looks back for the last uninherited timing point)
+FASTOSUPARSER_DEF FastOsuParser__Timing FastOsuParser__TimingAt(const FastOsuParser__Beatmap* beatmap, double time) {
 
-                                                        // Get "endTime"
-                                                        out->hit_objects[ho].object_params.end_time = atoi(i);
+        FastOsuParser__Timing timing = { 1000, 1, 4 };
 
-                                                }
-                                        }
+        ptrdiff_t tp = _FastOsuParser__TimingPointAt(beatmap, time);
+        if (tp >= 0 && beatmap->timing_index != NULL) return beatmap->timing_index[tp];
 
-                                        // Skip to next line
-                                        while (*i != '\n') i++;
-                                        i++;
+        // Uninherited timing point in effect (before the first one, the first one)
+        ptrdiff_t uninherited = tp;
+        while (uninherited >= 0 && !beatmap->timing_points[uninherited].b_uninherited) uninherited--;
+        if (uninherited < 0) {
+                for (uninherited = 0; uninherited < (ptrdiff_t)beatmap->timing_points_count && !beatmap->timing_points[uninherited].b_uninherited; uninherited++);
+        }
+        if (uninherited < (ptrdiff_t)beatmap->timing_points_count) {
+                timing.beat_length = beatmap->timing_points[uninherited].beat_length;
+                timing.meter = beatmap->timing_points[uninherited].meter;
+        }
 
-                                }
+        if (tp >= 0 && !beatmap->timing_points[tp].b_uninherited && beatmap->timing_points[tp].beat_length < 0) {
+                timing.slider_velocity = 100 / -beatmap->timing_points[tp].beat_length;
+                if (timing.slider_velocity < 0.1) timing.slider_velocity = 0.1;
+                if (timing.slider_velocity > 10) timing.slider_velocity = 10;
+        }
 
-                                out->hit_objects_count = hit_objects_count;
+        return timing;
 
-                                goto _FastOsuParser__Parse_END;
+}
 
-                        break;
+// Applies "timing_point" to the timing in effect before it
+FASTOSUPARSER_DEF void _FastOsuParser__TimingApply(FastOsuParser__Timing* timing, const FastOsuParser__TimingPoint* timing_point) {
 
-                }
+        if (timing_point->b_uninherited) {
+                timing->beat_length = timing_point->beat_length;
+                timing->meter = timing_point->meter;
+                timing->slider_velocity = 1;
+        }
+        else { // (negative inverse percentage, f.ex. -50 = 2x)
+                timing->slider_velocity = (timing_point->beat_length < 0) ? 100 / -timing_point->beat_length : 1;
+                if (timing->slider_velocity < 0.1) timing->slider_velocity = 0.1;
+                if (timing->slider_velocity > 10) timing->slider_velocity = 10;
+        }
 
+}
 
+// Timing in effect at hit objects, walked forward in step with them (they're sorted by time)
+typedef struct {
+        ptrdiff_t tp; // Timing point in effect (-1 before the first one)
+        FastOsuParser__Timing timing;
+        FastOsuParser__Timing first_timing; // Before the first timing point
+        double slider_multiplier;
+        double slider_tick_rate;
+} _FastOsuParser__TimingCursor;
 
-                while (*i != '\n') i++; // Skip to beginning of next line
+FASTOSUPARSER_DEF void _FastOsuParser__TimingCursorInit(_FastOsuParser__TimingCursor* cursor, const FastOsuParser__Beatmap* beatmap) {
 
+        // Before the first uninherited timing point, its beat length is used
+        FastOsuParser__Timing timing = { 1000, 1, 4 };
+        for (size_t tp = 0; tp < beatmap->timing_points_count; tp++) {
+                if (beatmap->timing_points[tp].b_uninherited) {
+                        timing.beat_length = beatmap->timing_points[tp].beat_length;
+                        timing.meter = beatmap->timing_points[tp].meter;
+                        break;
+                }
         }
 
+        cursor->tp = -1;
+        cursor->timing = timing;
+        cursor->first_timing = timing;
+        cursor->slider_multiplier = (beatmap->slider_multiplier > 0) ? beatmap->slider_multiplier : 1.4; // (osu!'s defaults)
+        cursor->slider_tick_rate = (beatmap->slider_tick_rate > 0) ? beatmap->slider_tick_rate : 1;
 
+}
 
-_FastOsuParser__Parse_END:
-        free(beatmap_file_contents);
+// Moves "cursor" to "time", then fills "*out" for a hit object there ("slides"/"length" for sliders, "end_time" for spinners)
+FASTOSUPARSER_DEF void _FastOsuParser__TimeHitObject(
+        _FastOsuParser__TimingCursor* cursor,
+        const FastOsuParser__Beatmap* beatmap,
+        int type,
+        int time,
+        int slides,
+        double length,
+        int end_time,
+        FastOsuParser__HitObjectTiming* out
+) {
+
+        // Hit objects are sorted by time, so the timing point in effect only moves forward
+        if (cursor->tp >= 0 && time < beatmap->timing_points[cursor->tp].time) { // (unless they're not)
+                cursor->tp = -1;
+                cursor->timing = cursor->first_timing;
+        }
+        while (cursor->tp+1 < (ptrdiff_t)beatmap->timing_points_count && beatmap->timing_points[cursor->tp+1].time <= time) {
+                cursor->tp++;
+                _FastOsuParser__TimingApply(&cursor->timing, &beatmap->timing_points[cursor->tp]);
+        }
 
-        return FastOsuParser__SUCCESS;
+        out->beat_length = cursor->timing.beat_length;
+        out->slider_velocity = cursor->timing.slider_velocity;
+        out->end_time = time;
+        out->ticks = 0;
+
+        if (type & 0b00000010) {
+                double distance_per_beat = 100 * cursor->slider_multiplier * cursor->timing.slider_velocity; // (px)
+                double velocity = distance_per_beat / cursor->timing.beat_length; // (px per ms)
+                out->end_time = time + slides * length / velocity;
+
+                // Ticks every "tick_distance" along each slide, but not within 10 ms of its end
+                double tick_distance = distance_per_beat / cursor->slider_tick_rate;
+                double ticks_end = length - velocity * 10;
+                if (tick_distance > 0 && ticks_end > 0) {
+                        if (tick_distance > length) tick_distance = length;
+                        out->ticks = ((int)ceil(ticks_end / tick_distance) - 1) * slides;
+                }
+        }
+        else if (type & 0b00001000) out->end_time = end_time;
 
 }
 
-void FastOsuParser__Free(FastOsuParser__Beatmap* beatmap) {
+// Fills "timing_index" (in one pass over the timing points), then "hit_object_timings" (in one pass merging them with the hit objects)
+FASTOSUPARSER_DEF void _FastOsuParser__IndexTiming(FastOsuParser__Beatmap* out) {
 
-        free(beatmap->timing_points);
-        free(beatmap->hit_objects);
+        _FastOsuParser__TimingCursor cursor;
+        _FastOsuParser__TimingCursorInit(&cursor, out);
 
-        for (int i = 0; i < beatmap->_total_curve_points_count; i++) free(beatmap->_total_curve_points[i]);
-        free(beatmap->_total_curve_points);
+        FastOsuParser__Timing timing = cursor.first_timing;
+        for (size_t tp = 0; tp < out->timing_points_count; tp++) {
+                _FastOsuParser__TimingApply(&timing, &out->timing_points[tp]);
+                out->timing_index[tp] = timing;
+        }
+
+        for (size_t ho = 0; ho < out->hit_objects_count; ho++) {
+
+                int type;
+                int time;
+                int slides = 0;
+                double length = 0;
+                int end_time = 0;
+                if (out->hit_objects != NULL) {
+                        const FastOsuParser__HitObject* hit_object = &out->hit_objects[ho];
+                        type = hit_object->type;
+                        time = hit_object->time;
+                        if (type & 0b00000010) {
+                                slides = hit_object->object_params.slides;
+                                length = hit_object->object_params.length;
+                        }
+                        else if (type & 0b00001000) end_time = hit_object->object_params.end_time;
+                }
+                else {
+                        type = out->hit_objects_type[ho];
+                        time = out->hit_objects_time[ho];
+                        int params = out->hit_objects_params[ho];
+                        if ((type & 0b00000010) && params != -1) {
+                                slides = out->sliders[params].slides;
+                                length = out->sliders[params].length;
+                        }
+                        else if ((type & 0b00001000) && params != -1) end_time = out->spinners[params].end_time;
+                }
+
+                _FastOsuParser__TimeHitObject(&cursor, out, type, time, slides, length, end_time, &out->hit_object_timings[ho]);
+
+        }
+
+}
+
+// Adds a hit object to "out->stats" (in file order, with "cursor" following them)
+FASTOSUPARSER_DEF void _FastOsuParser__StatsAdd(_FastOsuParser__TimingCursor* cursor, FastOsuParser__Beatmap* out, const FastOsuParser__HitObject* hit_object) {
+
+        FastOsuParser__Stats* stats = &out->stats;
+        char b_slider = (hit_object->type & 0b00000010) != 0;
+        char b_spinner = !b_slider && (hit_object->type & 0b00001000);
+
+        FastOsuParser__HitObjectTiming timing;
+        _FastOsuParser__TimeHitObject(
+                cursor, out, hit_object->type, hit_object->time,
+                b_slider ? hit_object->object_params.slides : 0,
+                b_slider ? hit_object->object_params.length : 0,
+                b_spinner ? hit_object->object_params.end_time : 0,
+                &timing
+        );
+
+        if (stats->max_combo == 0) stats->first_object_time = hit_object->time; // (every hit object adds to the combo)
+        stats->last_object_end_time = timing.end_time;
+
+        if (b_slider) {
+                stats->sliders_count++;
+                stats->max_combo += 1 + timing.ticks + hit_object->object_params.slides; // Head, ticks, then a repeat/tail per slide
+        }
+        else {
+                if (b_spinner) stats->spinners_count++;
+                else if (hit_object->type & 0b00000001) stats->circles_count++;
+                stats->max_combo++;
+        }
+
+}
+
+// Finishes "out->stats" once every hit object was added (lengths & BPMs)
+FASTOSUPARSER_DEF void _FastOsuParser__StatsFinish(FastOsuParser__Beatmap* out) {
+
+        FastOsuParser__Stats* stats = &out->stats;
+
+        if (stats->max_combo != 0) {
+                stats->total_length = stats->last_object_end_time - stats->first_object_time;
+                stats->drain_length = stats->total_length - stats->breaks_length;
+                if (stats->drain_length < 0) stats->drain_length = 0;
+        }
+
+        // The dominant BPM lasts the longest (summed per beat length) until the end of the last hit object, the first one from 0 on
+        double last_time = (stats->max_combo != 0) ? stats->last_object_end_time : (out->timing_points_count != 0) ? out->timing_points[out->timing_points_count-1].time : 0;
+        double dominant_beat_length = 0;
+        double dominant_duration = -DBL_MAX;
+        char b_first = 1;
+        for (size_t tp = 0; tp < out->timing_points_count; tp++) {
+
+                const FastOsuParser__TimingPoint* timing_point = &out->timing_points[tp];
+                if (!timing_point->b_uninherited || timing_point->beat_length <= 0) continue;
+
+                double bpm = 60000 / timing_point->beat_length;
+                if (stats->min_bpm == 0 || bpm < stats->min_bpm) stats->min_bpm = bpm;
+                if (bpm > stats->max_bpm) stats->max_bpm = bpm;
+
+                // Sum up every timing point with this beat length, unless an earlier one already did (few uninherited timing points, so quadratic is fine)
+                double beat_length = round(timing_point->beat_length * 1000) / 1000;
+                char b_counted = 0;
+                for (size_t previous = 0; previous < tp && !b_counted; previous++) {
+                        const FastOsuParser__TimingPoint* previous_point = &out->timing_points[previous];
+                        b_counted = previous_point->b_uninherited && previous_point->beat_length > 0 && round(previous_point->beat_length * 1000) / 1000 == beat_length;
+                }
+
+                if (!b_counted) {
+                        double duration = 0;
+                        char b_first_same = b_first;
+                        for (size_t same = tp; same < out->timing_points_count; same++) {
+                                const FastOsuParser__TimingPoint* same_point = &out->timing_points[same];
+                                if (!same_point->b_uninherited || same_point->beat_length <= 0) continue;
+
+                                size_t next = same+1;
+                                while (next < out->timing_points_count && (!out->timing_points[next].b_uninherited || out->timing_points[next].beat_length <= 0)) next++;
+
+                                if (round(same_point->beat_length * 1000) / 1000 == beat_length && same_point->time <= last_time) {
+                                        double from = b_first_same ? 0 : same_point->time;
+                                        double to = (next < out->timing_points_count) ? out->timing_points[next].time : last_time;
+                                        duration += to - from;
+                                }
+                                b_first_same = 0;
+                        }
+
+                        if (duration > dominant_duration) {
+                                dominant_duration = duration;
+                                dominant_beat_length = beat_length;
+                        }
+                }
+
+                b_first = 0;
+
+        }
+        if (dominant_beat_length > 0) stats->dominant_bpm = 60000 / dominant_beat_length;
+
+}
+
+// 64-bit non-cryptographic hash (XXH64), used to checksum cache files, detect changed source files & for FastOsuParser__PARSE_HASH
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__Rotl64(uint64_t x, int r) {
+        return (x << r) | (x >> (64-r));
+}
+
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__HashRound(uint64_t accumulator, uint64_t input) {
+        accumulator += input * 0xC2B2AE3D27D4EB4FULL;
+        accumulator = _FastOsuParser__Rotl64(accumulator, 31);
+        return accumulator * 0x9E3779B185EBCA87ULL;
+}
+
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__HashMerge(uint64_t hash, uint64_t accumulator) {
+        hash ^= _FastOsuParser__HashRound(0, accumulator);
+        return hash * 0x9E3779B185EBCA87ULL + 0x85EBCA77C2B2AE63ULL;
+}
+
+// Feeds a 32-byte stripe to the 4 accumulators
+FASTOSUPARSER_DEF void _FastOsuParser__HashStripe(uint64_t lanes[4], const unsigned char* i) {
+        uint64_t input[4];
+        memcpy(input, i, 32);
+        lanes[0] = _FastOsuParser__HashRound(lanes[0], input[0]);
+        lanes[1] = _FastOsuParser__HashRound(lanes[1], input[1]);
+        lanes[2] = _FastOsuParser__HashRound(lanes[2], input[2]);
+        lanes[3] = _FastOsuParser__HashRound(lanes[3], input[3]);
+}
+
+// Finishes a hash of "len" bytes from its accumulators & the last "tail_len" (< 32) bytes
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__HashFinish(const uint64_t lanes[4], const unsigned char* i, size_t tail_len, uint64_t len, uint64_t seed) {
+
+        const unsigned char* end = i+tail_len;
+        uint64_t hash;
+
+        if (len >= 32) {
+                hash = _FastOsuParser__Rotl64(lanes[0], 1) + _FastOsuParser__Rotl64(lanes[1], 7) + _FastOsuParser__Rotl64(lanes[2], 12) + _FastOsuParser__Rotl64(lanes[3], 18);
+                hash = _FastOsuParser__HashMerge(hash, lanes[0]);
+                hash = _FastOsuParser__HashMerge(hash, lanes[1]);
+                hash = _FastOsuParser__HashMerge(hash, lanes[2]);
+                hash = _FastOsuParser__HashMerge(hash, lanes[3]);
+        }
+        else hash = seed + 0x27D4EB2F165667C5ULL;
+
+        hash += len;
+
+        for (; i+8 <= end; i += 8) {
+                uint64_t lane;
+                memcpy(&lane, i, 8);
+                hash ^= _FastOsuParser__HashRound(0, lane);
+                hash = _FastOsuParser__Rotl64(hash, 27) * 0x9E3779B185EBCA87ULL + 0x85EBCA77C2B2AE63ULL;
+        }
+        if (i+4 <= end) {
+                uint32_t lane;
+                memcpy(&lane, i, 4);
+                hash ^= lane * 0x9E3779B185EBCA87ULL;
+                hash = _FastOsuParser__Rotl64(hash, 23) * 0xC2B2AE3D27D4EB4FULL + 0x165667B19E3779F9ULL;
+                i += 4;
+        }
+        for (; i < end; i++) {
+                hash ^= *i * 0x27D4EB2F165667C5ULL;
+                hash = _FastOsuParser__Rotl64(hash, 11) * 0x9E3779B185EBCA87ULL;
+        }
+
+        hash ^= hash >> 33;
+        hash *= 0xC2B2AE3D27D4EB4FULL;
+        hash ^= hash >> 29;
+        hash *= 0x165667B19E3779F9ULL;
+        hash ^= hash >> 32;
+
+        return hash;
+
+}
+
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__Hash64(const void* data, size_t len, uint64_t seed) {
+
+        const unsigned char* i = (const unsigned char*)data;
+        uint64_t lanes[4] = { seed + 0x9E3779B185EBCA87ULL + 0xC2B2AE3D27D4EB4FULL, seed + 0xC2B2AE3D27D4EB4FULL, seed, seed - 0x9E3779B185EBCA87ULL };
+
+        for (; i+32 <= (const unsigned char*)data + len; i += 32) _FastOsuParser__HashStripe(lanes, i);
+
+        return _FastOsuParser__HashFinish(lanes, i, (const unsigned char*)data + len - i, len, seed);
+
+}
+
+#define _FASTOSUPARSER_MD5_F(b, c, d) (((b) & (c)) | (~(b) & (d)))
+#define _FASTOSUPARSER_MD5_G(b, c, d) (((d) & (b)) | (~(d) & (c)))
+#define _FASTOSUPARSER_MD5_H(b, c, d) ((b) ^ (c) ^ (d))
+#define _FASTOSUPARSER_MD5_I(b, c, d) ((c) ^ ((b) | ~(d)))
+#define _FASTOSUPARSER_MD5_STEP(f, a, b, c, d, m, constant, shift) \
+        a += f(b, c, d) + words[m] + constant; \
+        a = ((a << shift) | (a >> (32-shift))) + b
+
+// MD5 (RFC 1321) of the file, like osu! identifies beatmaps by (FastOsuParser__PARSE_MD5)
+FASTOSUPARSER_DEF void _FastOsuParser__Md5Block(uint32_t state[4], const unsigned char* block) {
+
+        uint32_t words[16];
+        for (int n = 0; n < 16; n++) words[n] = (uint32_t)block[4*n] | (uint32_t)block[4*n+1] << 8 | (uint32_t)block[4*n+2] << 16 | (uint32_t)block[4*n+3] << 24;
+
+        uint32_t a = state[0];
+        uint32_t b = state[1];
+        uint32_t c = state[2];
+        uint32_t d = state[3];
+
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, a, b, c, d,  0, 0xD76AA478,  7);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, d, a, b, c,  1, 0xE8C7B756, 12);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, c, d, a, b,  2, 0x242070DB, 17);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, b, c, d, a,  3, 0xC1BDCEEE, 22);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, a, b, c, d,  4, 0xF57C0FAF,  7);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, d, a, b, c,  5, 0x4787C62A, 12);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, c, d, a, b,  6, 0xA8304613, 17);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, b, c, d, a,  7, 0xFD469501, 22);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, a, b, c, d,  8, 0x698098D8,  7);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, d, a, b, c,  9, 0x8B44F7AF, 12);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, c, d, a, b, 10, 0xFFFF5BB1, 17);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, b, c, d, a, 11, 0x895CD7BE, 22);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, a, b, c, d, 12, 0x6B901122,  7);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, d, a, b, c, 13, 0xFD987193, 12);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, c, d, a, b, 14, 0xA679438E, 17);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_F, b, c, d, a, 15, 0x49B40821, 22);
+
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, a, b, c, d,  1, 0xF61E2562,  5);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, d, a, b, c,  6, 0xC040B340,  9);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, c, d, a, b, 11, 0x265E5A51, 14);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, b, c, d, a,  0, 0xE9B6C7AA, 20);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, a, b, c, d,  5, 0xD62F105D,  5);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, d, a, b, c, 10, 0x02441453,  9);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, c, d, a, b, 15, 0xD8A1E681, 14);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, b, c, d, a,  4, 0xE7D3FBC8, 20);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, a, b, c, d,  9, 0x21E1CDE6,  5);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, d, a, b, c, 14, 0xC33707D6,  9);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, c, d, a, b,  3, 0xF4D50D87, 14);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, b, c, d, a,  8, 0x455A14ED, 20);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, a, b, c, d, 13, 0xA9E3E905,  5);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, d, a, b, c,  2, 0xFCEFA3F8,  9);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, c, d, a, b,  7, 0x676F02D9, 14);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_G, b, c, d, a, 12, 0x8D2A4C8A, 20);
+
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, a, b, c, d,  5, 0xFFFA3942,  4);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, d, a, b, c,  8, 0x8771F681, 11);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, c, d, a, b, 11, 0x6D9D6122, 16);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, b, c, d, a, 14, 0xFDE5380C, 23);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, a, b, c, d,  1, 0xA4BEEA44,  4);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, d, a, b, c,  4, 0x4BDECFA9, 11);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, c, d, a, b,  7, 0xF6BB4B60, 16);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, b, c, d, a, 10, 0xBEBFBC70, 23);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, a, b, c, d, 13, 0x289B7EC6,  4);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, d, a, b, c,  0, 0xEAA127FA, 11);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, c, d, a, b,  3, 0xD4EF3085, 16);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, b, c, d, a,  6, 0x04881D05, 23);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, a, b, c, d,  9, 0xD9D4D039,  4);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, d, a, b, c, 12, 0xE6DB99E5, 11);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, c, d, a, b, 15, 0x1FA27CF8, 16);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_H, b, c, d, a,  2, 0xC4AC5665, 23);
+
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, a, b, c, d,  0, 0xF4292244,  6);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, d, a, b, c,  7, 0x432AFF97, 10);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, c, d, a, b, 14, 0xAB9423A7, 15);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, b, c, d, a,  5, 0xFC93A039, 21);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, a, b, c, d, 12, 0x655B59C3,  6);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, d, a, b, c,  3, 0x8F0CCC92, 10);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, c, d, a, b, 10, 0xFFEFF47D, 15);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, b, c, d, a,  1, 0x85845DD1, 21);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, a, b, c, d,  8, 0x6FA87E4F,  6);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, d, a, b, c, 15, 0xFE2CE6E0, 10);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, c, d, a, b,  6, 0xA3014314, 15);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, b, c, d, a, 13, 0x4E0811A1, 21);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, a, b, c, d,  4, 0xF7537E82,  6);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, d, a, b, c, 11, 0xBD3AF235, 10);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, c, d, a, b,  2, 0x2AD7D2BB, 15);
+        _FASTOSUPARSER_MD5_STEP(_FASTOSUPARSER_MD5_I, b, c, d, a,  9, 0xEB86D391, 21);
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+
+}
+
+#undef _FASTOSUPARSER_MD5_F
+#undef _FASTOSUPARSER_MD5_G
+#undef _FASTOSUPARSER_MD5_H
+#undef _FASTOSUPARSER_MD5_I
+#undef _FASTOSUPARSER_MD5_STEP
+
+// MD5 and/or XXH64 (FastOsuParser__PARSE_MD5/_HASH) of data arriving in pieces, both fed from the same 64-byte blocks
+typedef struct {
+        int flags;
+        uint32_t md5[4];
+        uint64_t lanes[4]; // (XXH64 accumulators, seed 0)
+        uint64_t len;
+        unsigned char block[64]; // Unfinished block
+        size_t block_size;
+} _FastOsuParser__Hasher;
+
+FASTOSUPARSER_DEF void _FastOsuParser__HasherInit(_FastOsuParser__Hasher* hasher, int flags) {
+
+        memset(hasher, 0, sizeof(*hasher));
+        hasher->flags = flags & (FastOsuParser__PARSE_MD5 | FastOsuParser__PARSE_HASH);
+
+        hasher->md5[0] = 0x67452301;
+        hasher->md5[1] = 0xEFCDAB89;
+        hasher->md5[2] = 0x98BADCFE;
+        hasher->md5[3] = 0x10325476;
+
+        hasher->lanes[0] = 0x9E3779B185EBCA87ULL + 0xC2B2AE3D27D4EB4FULL;
+        hasher->lanes[1] = 0xC2B2AE3D27D4EB4FULL;
+        hasher->lanes[2] = 0;
+        hasher->lanes[3] = 0 - 0x9E3779B185EBCA87ULL;
+
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__HasherBlocks(_FastOsuParser__Hasher* hasher, const unsigned char* i, size_t blocks_count) {
+
+        for (; blocks_count != 0; blocks_count--, i += 64) { // (each block is read once for both)
+                if (hasher->flags & FastOsuParser__PARSE_MD5) _FastOsuParser__Md5Block(hasher->md5, i);
+                if (hasher->flags & FastOsuParser__PARSE_HASH) {
+                        _FastOsuParser__HashStripe(hasher->lanes, i);
+                        _FastOsuParser__HashStripe(hasher->lanes, i+32);
+                }
+        }
+
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__HasherUpdate(_FastOsuParser__Hasher* hasher, const void* data, size_t len) {
+
+        if (len == 0) return; // ("data" can be NULL then, f.ex. for an empty file, which memcpy() mustn't get)
+
+        const unsigned char* i = (const unsigned char*)data;
+        hasher->len += len;
+
+        // Complete the unfinished block first
+        if (hasher->block_size != 0) {
+                size_t missing = 64 - hasher->block_size;
+                if (missing > len) missing = len;
+                memcpy(hasher->block + hasher->block_size, i, missing);
+                hasher->block_size += missing;
+                i += missing;
+                len -= missing;
+
+                if (hasher->block_size < 64) return;
+                _FastOsuParser__HasherBlocks(hasher, hasher->block, 1);
+                hasher->block_size = 0;
+        }
+
+        // Whole blocks straight from "data"
+        _FastOsuParser__HasherBlocks(hasher, i, len / 64);
+        i += len / 64 * 64;
+        len %= 64;
+
+        memcpy(hasher->block, i, len);
+        hasher->block_size = len;
+
+}
+
+// Writes the requested digests into "out->md5"/"out->hash"
+FASTOSUPARSER_DEF void _FastOsuParser__HasherFinish(_FastOsuParser__Hasher* hasher, FastOsuParser__Beatmap* out) {
+
+        if (hasher->flags & FastOsuParser__PARSE_HASH) {
+                const unsigned char* tail = hasher->block;
+                uint64_t lanes[4];
+                memcpy(lanes, hasher->lanes, sizeof(lanes));
+                if (hasher->block_size >= 32) {
+                        _FastOsuParser__HashStripe(lanes, tail);
+                        tail += 32;
+                }
+                out->hash = _FastOsuParser__HashFinish(lanes, tail, hasher->block + hasher->block_size - tail, hasher->len, 0);
+        }
+
+        if (hasher->flags & FastOsuParser__PARSE_MD5) {
+                // Pad with 0x80, then 0s up to the length (in bits) at the end of a block
+                hasher->block[hasher->block_size++] = 0x80;
+                if (hasher->block_size > 56) {
+                        memset(hasher->block + hasher->block_size, 0, 64 - hasher->block_size);
+                        _FastOsuParser__Md5Block(hasher->md5, hasher->block);
+                        hasher->block_size = 0;
+                }
+                memset(hasher->block + hasher->block_size, 0, 56 - hasher->block_size);
+                for (int n = 0; n < 8; n++) hasher->block[56+n] = (unsigned char)((hasher->len * 8) >> (8*n));
+                _FastOsuParser__Md5Block(hasher->md5, hasher->block);
+
+                for (int n = 0; n < 16; n++) out->md5[n] = (unsigned char)(hasher->md5[n/4] >> (8*(n%4)));
+        }
+
+}
+
+
+
+// Moves "*i" on to "*tail" (if it's there) once the current piece of [HitObjects] is done
+FASTOSUPARSER_DEF int _FastOsuParser__NextPiece(const char** i, const char** end, const char** tail, const char* tail_end, _FastOsuParser__Scanner* scanner) {
+
+        if (*tail == NULL) return 0;
+
+        *i = *tail;
+        *end = tail_end;
+        *tail = NULL;
+        _FastOsuParser__ScannerInit(scanner, *i, *end);
+
+        return 1;
+
+}
+
+// Moves "*i" past empty lines (left out of the line counts, so every [HitObjects] loop skips them), on to "*tail" like _FastOsuParser__NextPiece()
+FASTOSUPARSER_DEF void _FastOsuParser__SkipEmptyLines(const char** i, const char** end, const char** tail, const char* tail_end, _FastOsuParser__Scanner* scanner) {
+
+        for (;;) {
+                if (*i >= *end && !_FastOsuParser__NextPiece(i, end, tail, tail_end, scanner)) return;
+                if (**i != '\r' && **i != '\n') return;
+                *i = _FastOsuParser__ScannerNext(scanner)+1;
+        }
+
+}
+
+// Adds the non-empty lines & the '|' in ["i", "end") ("i" starts a line)
+FASTOSUPARSER_DEF void _FastOsuParser__CountLines(const char* i, const char* end, size_t* lines_count, size_t* pipes_count) {
+
+        uint64_t previous_newline = 1;
+        for (; i < end; i += 64) {
+                _FastOsuParser__BlockMasks masks;
+                _FastOsuParser__Classify(i, end, &masks);
+
+                uint64_t valid = (end-i < 64) ? (1ULL << (end-i)) - 1 : ~0ULL;
+                uint64_t line_starts = ((masks.newline << 1) | previous_newline) & valid;
+                previous_newline = masks.newline >> 63;
+
+                *lines_count += _FastOsuParser__Popcount64(line_starts & ~(masks.newline | masks.carriage_return));
+                *pipes_count += _FastOsuParser__Popcount64(masks.pipe & valid);
+        }
+
+}
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+
+#if !defined(FASTOSUPARSER_PARALLEL_THRESHOLD)
+#define FASTOSUPARSER_PARALLEL_THRESHOLD (1 << 20) // Size of [HitObjects] (bytes) from which it's parsed on multiple threads
+#endif
+
+#if !defined(FASTOSUPARSER_PARALLEL_THREADS)
+#define FASTOSUPARSER_PARALLEL_THREADS 0 // Most threads to parse a big [HitObjects] on, 0 = one per CPU core (either way at most _FASTOSUPARSER_PARALLEL_MAX_THREADS)
+#endif
+
+#define _FASTOSUPARSER_PARALLEL_MAX_THREADS 64 // (chunks live on the stack, more threads than that split a section too finely to pay off anyway)
+
+// A slice of [HitObjects] (whole lines), counted then parsed on its own thread
+typedef struct _FastOsuParser__HitObjectsChunk _FastOsuParser__HitObjectsChunk;
+struct _FastOsuParser__HitObjectsChunk {
+        void (*work)(_FastOsuParser__HitObjectsChunk* chunk);
+        const char* begin;
+        const char* end;
+        int flags;
+
+        size_t lines_count; // Non-empty lines
+        size_t pipes_count; // (room for its curve points)
+
+        FastOsuParser__HitObject* hit_objects;
+        size_t hit_objects_count;
+        FastOsuParser__CurvePoint* curve_points;
+        FastOsuParser__CurvePoint* curve_points_end; // After parsing: after the last one written
+
+        _FastOsuParser__Thread thread;
+        char b_thread_started;
+};
+
+FASTOSUPARSER_DEF void _FastOsuParser__CountChunk(_FastOsuParser__HitObjectsChunk* chunk) {
+        _FastOsuParser__CountLines(chunk->begin, chunk->end, &chunk->lines_count, &chunk->pipes_count);
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__ParseChunk(_FastOsuParser__HitObjectsChunk* chunk) {
+
+        const char* i = chunk->begin;
+        const char* end = chunk->end;
+        const char* tail = NULL;
+        _FastOsuParser__Scanner scanner;
+        _FastOsuParser__ScannerInit(&scanner, i, end);
+
+        FastOsuParser__CurvePoint* curve_points = chunk->curve_points;
+        for (size_t ho = 0; ho < chunk->hit_objects_count; ho++) {
+                _FastOsuParser__SkipEmptyLines(&i, &end, &tail, NULL, &scanner);
+                _FastOsuParser__ParseHitObject(&i, &scanner, chunk->end, chunk->flags, &chunk->hit_objects[ho], &curve_points, chunk->curve_points_end);
+        }
+        chunk->curve_points_end = curve_points;
+
+}
+
+#if defined(_WIN32)
+FASTOSUPARSER_DEF DWORD WINAPI _FastOsuParser__ChunkThread(LPVOID chunk) {
+        ((_FastOsuParser__HitObjectsChunk*)chunk)->work((_FastOsuParser__HitObjectsChunk*)chunk);
+        return 0;
+}
+#else
+FASTOSUPARSER_DEF void* _FastOsuParser__ChunkThread(void* chunk) {
+        ((_FastOsuParser__HitObjectsChunk*)chunk)->work((_FastOsuParser__HitObjectsChunk*)chunk);
+        return NULL;
+}
+#endif
+
+// Runs "work" on every chunk, the first one on this thread (chunks whose thread fails to start too)
+FASTOSUPARSER_DEF void _FastOsuParser__RunChunks(_FastOsuParser__HitObjectsChunk* chunks, size_t chunks_count, void (*work)(_FastOsuParser__HitObjectsChunk* chunk)) {
+
+        for (size_t n = 1; n < chunks_count; n++) {
+                chunks[n].work = work;
+#if defined(_WIN32)
+                chunks[n].thread = CreateThread(NULL, 0, _FastOsuParser__ChunkThread, &chunks[n], 0, NULL);
+                chunks[n].b_thread_started = (chunks[n].thread != NULL);
+#else
+                chunks[n].b_thread_started = (pthread_create(&chunks[n].thread, NULL, _FastOsuParser__ChunkThread, &chunks[n]) == 0);
+#endif
+        }
+
+        work(&chunks[0]);
+
+        for (size_t n = 1; n < chunks_count; n++) {
+                if (!chunks[n].b_thread_started) {
+                        work(&chunks[n]);
+                        continue;
+                }
+#if defined(_WIN32)
+                WaitForSingleObject(chunks[n].thread, INFINITE);
+                CloseHandle(chunks[n].thread);
+#else
+                pthread_join(chunks[n].thread, NULL);
+#endif
+        }
+
+}
+
+// Parses the hit objects of [HitObjects] in ["i", "end") into "hit_objects" on multiple threads, like the sequential loop would (up to "hit_objects_count" of them)
+// Each chunk gets the slice of hit objects & curve points after the ones before it (counted in parallel first), then the curve points are moved together
+// Returns how many were parsed, 0 (without parsing anything) if the section is too small for it to pay off
+FASTOSUPARSER_DEF size_t _FastOsuParser__ParseHitObjectsParallel(const char* i, const char* end, int flags, FastOsuParser__Beatmap* out, FastOsuParser__CurvePoint** curve_points, FastOsuParser__CurvePoint* curve_points_end) {
+
+        if ((size_t)(end-i) < FASTOSUPARSER_PARALLEL_THRESHOLD) return 0;
+
+        _FastOsuParser__HitObjectsChunk chunks[_FASTOSUPARSER_PARALLEL_MAX_THREADS];
+        size_t chunks_count = (FASTOSUPARSER_PARALLEL_THREADS != 0) ? FASTOSUPARSER_PARALLEL_THREADS : _FastOsuParser__CpuCount();
+        if (chunks_count > _FASTOSUPARSER_PARALLEL_MAX_THREADS) chunks_count = _FASTOSUPARSER_PARALLEL_MAX_THREADS;
+        size_t chunk_size = FASTOSUPARSER_PARALLEL_THRESHOLD / 16; // (smallest worth a thread)
+        if (chunk_size != 0 && chunks_count > (size_t)(end-i) / chunk_size) chunks_count = (end-i) / chunk_size;
+        if (chunks_count < 2) return 0;
+
+        // Split at newlines
+        const char* begin = i;
+        size_t n = 0;
+        for (size_t k = 0; k < chunks_count && begin < end; k++) {
+                const char* split = (k == chunks_count-1) ? end : i + (end-i) * (k+1) / chunks_count;
+                if (split < begin) split = begin;
+                const char* newline = (split < end) ? (const char*)memchr(split, '\n', end-split) : NULL;
+                split = (newline == NULL) ? end : newline+1;
+
+                memset(&chunks[n], 0, sizeof(chunks[n]));
+                chunks[n].begin = begin;
+                chunks[n].end = split;
+                chunks[n].flags = flags;
+                begin = split;
+                n++;
+        }
+        chunks_count = n;
+
+        _FastOsuParser__RunChunks(chunks, chunks_count, _FastOsuParser__CountChunk);
+
+        // Slices (lines after the last hit object belong to whatever section comes next)
+        size_t hit_objects_offset = 0;
+        FastOsuParser__CurvePoint* chunk_curve_points = *curve_points;
+        for (n = 0; n < chunks_count; n++) {
+                size_t remaining = out->hit_objects_count - hit_objects_offset;
+                chunks[n].hit_objects = out->hit_objects + hit_objects_offset;
+                chunks[n].hit_objects_count = (chunks[n].lines_count < remaining) ? chunks[n].lines_count : remaining;
+                hit_objects_offset += chunks[n].hit_objects_count;
+
+                chunks[n].curve_points = chunk_curve_points;
+                if (_FASTOSUPARSER_CURVE_POINTS_STORAGE(flags)) {
+                        size_t room = curve_points_end - chunk_curve_points;
+                        chunk_curve_points += (chunks[n].pipes_count < room) ? chunks[n].pipes_count : room;
+                }
+                chunks[n].curve_points_end = chunk_curve_points;
+        }
+
+        _FastOsuParser__RunChunks(chunks, chunks_count, _FastOsuParser__ParseChunk);
+
+        // Close the gaps between the chunks' curve points ('|' also separate edge sounds/sets, so each chunk had room to spare)
+        FastOsuParser__CurvePoint* next = *curve_points;
+        for (n = 0; n < chunks_count; n++) {
+                size_t used = chunks[n].curve_points_end - chunks[n].curve_points;
+                ptrdiff_t shift = next - chunks[n].curve_points;
+                if (shift != 0 && used != 0) {
+                        memmove(next, chunks[n].curve_points, used * sizeof(FastOsuParser__CurvePoint));
+                        for (size_t ho = 0; ho < chunks[n].hit_objects_count; ho++) {
+                                FastOsuParser__HitObject* hit_object = &chunks[n].hit_objects[ho];
+                                if ((hit_object->type & 0b00000010) && hit_object->object_params.curve_points != NULL) hit_object->object_params.curve_points += shift;
+                        }
+                }
+                next += used;
+        }
+        *curve_points = next;
+
+        return hit_objects_offset;
+
+}
+
+#endif
+
+#if defined(FASTOSUPARSER_PROFILE)
+
+// Monotonic clock (ns)
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__Now() {
+#if defined(_WIN32)
+        LARGE_INTEGER counter, frequency;
+        QueryPerformanceCounter(&counter);
+        QueryPerformanceFrequency(&frequency);
+        return (uint64_t)((double)counter.QuadPart * 1e9 / (double)frequency.QuadPart);
+#else
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+#endif
+}
+
+// Charges the time & bytes since "*start"/"*start_i" to "section", then restarts from now/"i"
+FASTOSUPARSER_DEF void _FastOsuParser__ProfileSection(FastOsuParser__Profile* profile, int section, uint64_t* start, const char** start_i, const char* i) {
+
+        uint64_t now = _FastOsuParser__Now();
+        profile->section_ns[section] += now - *start;
+        if (i > *start_i) profile->section_bytes[section] += i - *start_i;
+        *start = now;
+        *start_i = i;
+
+}
+
+#endif
+
+#if !defined(FASTOSUPARSER_PADDING)
+#define FASTOSUPARSER_PADDING 64 // Sentinel bytes the loaders put after every file they read (a multiple of 2, at least 32)
+#endif
+
+// Writes FASTOSUPARSER_PADDING sentinel bytes ("\r\n\r\n...") at "end"
+// The parser never checks for the end of its input while scanning a line or a value, these stop every scan inside the padding instead
+FASTOSUPARSER_DEF void FastOsuParser__Pad(char* end) {
+
+        for (int p = 0; p < FASTOSUPARSER_PADDING; p += 2) {
+                end[p] = '\r';
+                end[p+1] = '\n';
+        }
+
+}
+
+// Makes "*buffer" hold at least "size" bytes plus FASTOSUPARSER_PADDING, growing it (geometrically) only if it's too small
+FASTOSUPARSER_DEF int _FastOsuParser__ReserveBuffer(char** buffer, size_t* buffer_capacity, size_t size) {
+
+        if (*buffer != NULL && size <= *buffer_capacity) return 1;
+
+        size_t new_capacity = *buffer_capacity * 2;
+        if (new_capacity < size) new_capacity = size;
+
+        free(*buffer);
+        *buffer = (char*)malloc(new_capacity + FASTOSUPARSER_PADDING);
+        *buffer_capacity = (*buffer == NULL) ? 0 : new_capacity;
+        return *buffer != NULL;
+
+}
+
+// FastOsuParser__ParseBuffer() with its flags resolved & digests already done, "data" must be padded (FastOsuParser__Pad(data+len))
+// With "range_begin", only the [HitObjects] lines in ["range_begin", "range_end") are parsed (FastOsuParser__ParseRange())
+// With "tail_begin", the file goes on in ["tail_begin", "tail_end") (padded), & "data" ends at a line start with FASTOSUPARSER_PADDING bytes of it after it
+// instead of the padding: [HitObjects] continues there, nothing else does (see _FastOsuParser__ParseBufferPadding())
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ParseBufferFlags(const char* data, size_t len, int flags, const char* range_begin, const char* range_end, const char* tail_begin, const char* tail_end, FastOsuParser__Beatmap* out) {
+
+        if (flags & FastOsuParser__PARSE_STATS) flags |= FastOsuParser__PARSE_DIFFICULTY | FastOsuParser__PARSE_TIMING_POINTS; // (for slider ticks & BPMs)
+
+        int sections = flags & FastOsuParser__PARSE_SECTIONS; // Sections to read
+        if (flags & FastOsuParser__PARSE_STATS) sections |= (int)_FastOsuParser__PARSE_EVENTS | FastOsuParser__PARSE_HIT_OBJECTS; // (hit objects are only stored if in "flags")
+        int remaining_sections = sections; // Stop reading once these are done
+
+#if defined(FASTOSUPARSER_PROFILE)
+        uint64_t profile_begin = _FastOsuParser__Now();
+#endif
+
+        // Allocate all dynamic memory up-front in a single block
+        size_t pipes_count = 0;
+        _FastOsuParser__Section count_section = _FastOsuParser__SECTION_NONE;
+        if (range_begin == NULL) {
+                _FastOsuParser__CountSections(data, data+len, flags, &out->timing_points_count, &out->hit_objects_count, &pipes_count, &count_section);
+                if (tail_begin != NULL) _FastOsuParser__CountSections(tail_begin, tail_end, flags, &out->timing_points_count, &out->hit_objects_count, &pipes_count, &count_section);
+        }
+        else {
+                _FastOsuParser__CountSections(data, data+len, flags & ~FastOsuParser__PARSE_HIT_OBJECTS, &out->timing_points_count, &out->hit_objects_count, &pipes_count, &count_section);
+                _FastOsuParser__CountLines(range_begin, range_end, &out->hit_objects_count, &pipes_count);
+        }
+        size_t curve_points_count = _FASTOSUPARSER_CURVE_POINTS_STORAGE(flags) ? pipes_count : 0;
+#if defined(FASTOSUPARSER_PROFILE)
+        out->profile.count_ns += _FastOsuParser__Now() - profile_begin;
+#endif
+
+        size_t arena_size = // (all element types are 8-byte aligned or less, so no padding needed in between)
+                sizeof(FastOsuParser__TimingPoint) * out->timing_points_count +
+                sizeof(FastOsuParser__CurvePoint) * curve_points_count;
+
+        size_t column_size = 0; // (rounded up to keep every column 64-byte aligned)
+        size_t sliders_capacity = 0;
+        if (flags & FastOsuParser__PARSE_COLUMNS) {
+                column_size = (sizeof(int) * out->hit_objects_count + 63) & ~(size_t)63;
+                sliders_capacity = (pipes_count < out->hit_objects_count) ? pipes_count : out->hit_objects_count; // (every slider has at least one '|')
+                arena_size +=
+                        63 + 5 * column_size + // (+ room to align the first one)
+                        sizeof(FastOsuParser__Slider) * sliders_capacity +
+                        sizeof(FastOsuParser__Spinner) * out->hit_objects_count;
+        }
+        else arena_size += sizeof(FastOsuParser__HitObject) * out->hit_objects_count;
+
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                arena_size +=
+                        sizeof(FastOsuParser__Timing) * out->timing_points_count +
+                        sizeof(FastOsuParser__HitObjectTiming) * out->hit_objects_count;
+        }
+
+        if (arena_size != 0) {
+                if (out->allocator.alloc != NULL) out->_arena = out->allocator.alloc(arena_size, out->allocator.user);
+                else out->_arena = malloc(arena_size);
+                if (out->_arena == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+#if defined(FASTOSUPARSER_PROFILE)
+                out->profile.allocations++;
+                out->profile.allocated_bytes += arena_size;
+#endif
+        }
+
+        char* arena = (char*)out->_arena;
+        if (flags & FastOsuParser__PARSE_COLUMNS) {
+                // [columns][sliders][spinners][timing points][curve points]
+                arena += (64 - (uintptr_t)arena % 64) % 64;
+                out->hit_objects_x = (int*)arena;
+                out->hit_objects_y = (int*)(arena + column_size);
+                out->hit_objects_time = (int*)(arena + 2*column_size);
+                out->hit_objects_type = (int*)(arena + 3*column_size);
+                out->hit_objects_params = (int*)(arena + 4*column_size);
+                out->sliders = (FastOsuParser__Slider*)(arena + 5*column_size);
+                out->spinners = (FastOsuParser__Spinner*)(out->sliders + sliders_capacity);
+                arena = (char*)(out->spinners + out->hit_objects_count);
+        }
+        out->timing_points = (FastOsuParser__TimingPoint*)arena;
+        arena = (char*)(out->timing_points + out->timing_points_count);
+        if (!(flags & FastOsuParser__PARSE_COLUMNS)) {
+                out->hit_objects = (FastOsuParser__HitObject*)arena;
+                arena = (char*)(out->hit_objects + out->hit_objects_count);
+        }
+        FastOsuParser__CurvePoint* curve_points = (FastOsuParser__CurvePoint*)arena; // Next free curve point
+        FastOsuParser__CurvePoint* curve_points_end = curve_points + curve_points_count;
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                out->timing_index = (FastOsuParser__Timing*)curve_points_end;
+                out->hit_object_timings = (FastOsuParser__HitObjectTiming*)(out->timing_index + out->timing_points_count);
+        }
+
+
+
+        _FastOsuParser__Section current_section = _FastOsuParser__SECTION_NONE;
+        int current_section_flag = 0;
+        const char* tail = tail_begin; // (NULL once [HitObjects] moved on to it)
+
+#if defined(FASTOSUPARSER_PROFILE)
+        FastOsuParser__CurvePoint* profile_curve_points = curve_points;
+        int profile_section = FastOsuParser__PROFILE_SKIPPED; // (what the time since "profile_start" is charged to)
+        uint64_t profile_start = _FastOsuParser__Now();
+        const char* profile_start_i = data;
+#endif
+
+        const char* i = data; // Current beatmap file content index
+        while (i < data+len && *i != '[') i++; // Skip to first section
+        for (; i < data+len; i++) {
+
+                if (*i == '[') { // If new section:
+
+#if defined(FASTOSUPARSER_PROFILE)
+                        _FastOsuParser__ProfileSection(&out->profile, profile_section, &profile_start, &profile_start_i, i);
+#endif
+
+                        // Finished with the previous section
+                        remaining_sections &= ~current_section_flag;
+                        if (remaining_sections == 0) goto _FastOsuParser__Parse_END;
+
+                        i++;
+                        switch (*i) { // Update current_section state based on first letter
+
+                                case 'G':
+                                        current_section = _FastOsuParser__SECTION_GENERAL;
+                                        current_section_flag = FastOsuParser__PARSE_GENERAL;
+                                break;
+
+                                case 'M':
+                                        current_section = _FastOsuParser__SECTION_METADATA;
+                                        current_section_flag = FastOsuParser__PARSE_METADATA;
+                                break;
+
+                                case 'D':
+                                        current_section = _FastOsuParser__SECTION_DIFFICULTY;
+                                        current_section_flag = FastOsuParser__PARSE_DIFFICULTY;
+                                break;
+
+                                case 'E':
+                                        if (*(i+1) == 'v') { // ([Editor] isn't parsed)
+                                                current_section = _FastOsuParser__SECTION_EVENTS;
+                                                current_section_flag = _FastOsuParser__PARSE_EVENTS;
+                                        }
+                                        else {
+                                                current_section = _FastOsuParser__SECTION_NONE;
+                                                current_section_flag = 0;
+                                        }
+                                break;
+
+                                case 'T':
+                                        current_section = _FastOsuParser__SECTION_TIMING_POINTS;
+                                        current_section_flag = FastOsuParser__PARSE_TIMING_POINTS;
+                                break;
+
+                                case 'H':
+                                        current_section = _FastOsuParser__SECTION_HIT_OBJECTS;
+                                        current_section_flag = FastOsuParser__PARSE_HIT_OBJECTS;
+                                break;
+
+                                default:
+                                        current_section = _FastOsuParser__SECTION_NONE;
+                                        current_section_flag = 0;
+
+                        }
+
+                        if (!(sections & current_section_flag)) current_section = _FastOsuParser__SECTION_NONE; // Not requested
+#if defined(FASTOSUPARSER_PROFILE)
+                        profile_section = current_section; // (same order)
+#endif
+
+                        while (*i != '\n') i++; // Skip to next line (CRLF or LF, stops in the padding at the latest)
+                        if (i+1 >= data+len) goto _FastOsuParser__Parse_END; // (the header was the last line)
+                        if (*(i+1) == '[') continue; // (empty section, the next header is handled next)
+                        i++;
+
+                }
+
+
+
+                switch (current_section) {
+
+                        case _FastOsuParser__SECTION_NONE: // Skip to the next section header
+
+                                for (;;) {
+                                        const char* newline = (const char*)memchr(i, '\n', data+len-i);
+                                        if (newline == NULL || newline+1 >= data+len) goto _FastOsuParser__Parse_END;
+
+                                        i = newline;
+                                        if (*(i+1) == '[') break;
+                                        i++;
+                                }
+
+                        break;
+
+
+
+                        case _FastOsuParser__SECTION_GENERAL:
+                        case _FastOsuParser__SECTION_METADATA:
+                        case _FastOsuParser__SECTION_DIFFICULTY:
+
+                        {
+                                FastOsuParser__Error error = _FastOsuParser__ParseKeyValue(i, out);
+                                if (error != FastOsuParser__SUCCESS) return error;
+                        }
+                        break;
+
+
+
+                        case _FastOsuParser__SECTION_EVENTS:
+
+                                _FastOsuParser__ParseEvent(i, out);
+
+                        break;
+
+
+
+                        case _FastOsuParser__SECTION_TIMING_POINTS: // (counted & allocated by _FastOsuParser__CountSections())
+
+                        {
+
+                                _FastOsuParser__Scanner scanner;
+                                _FastOsuParser__ScannerInit(&scanner, i, data+len);
+
+                                for (size_t tp = 0; tp < out->timing_points_count; tp++) {
+                                        _FastOsuParser__ParseTimingPoint(&i, &scanner, data+len, &out->timing_points[tp]);
+                                }
+
+                        }
+
+                                // Finished with this section
+                                current_section = _FastOsuParser__SECTION_NONE;
+                                current_section_flag = 0;
+                                remaining_sections &= ~FastOsuParser__PARSE_TIMING_POINTS;
+                                if (remaining_sections == 0) goto _FastOsuParser__Parse_END;
+
+                        break;
+
+
+
+                        case _FastOsuParser__SECTION_HIT_OBJECTS: // Assumed that [HitObjects] is the last section in the file (counted & allocated by _FastOsuParser__CountSections())
+
+                        {
+
+                                const char* hit_objects_end = data+len;
+                                if (range_begin != NULL) {
+                                        i = range_begin;
+                                        hit_objects_end = range_end;
+                                }
+
+                                _FastOsuParser__Scanner scanner;
+                                _FastOsuParser__ScannerInit(&scanner, i, hit_objects_end);
+
+                                char b_stats = (flags & FastOsuParser__PARSE_STATS) != 0;
+                                _FastOsuParser__TimingCursor cursor; // (for the stats, [TimingPoints] comes first)
+                                if (b_stats) _FastOsuParser__TimingCursorInit(&cursor, out);
+
+                                if (!(flags & FastOsuParser__PARSE_HIT_OBJECTS)) { // Only for the stats, nothing is stored (so nothing was counted either)
+                                        while ((i < hit_objects_end || _FastOsuParser__NextPiece(&i, &hit_objects_end, &tail, tail_end, &scanner)) && *i != '[') {
+                                                if (*i == '\r' || *i == '\n') { // Skip empty lines
+                                                        i = _FastOsuParser__ScannerNext(&scanner)+1;
+                                                        continue;
+                                                }
+
+                                                FastOsuParser__HitObject hit_object;
+                                                memset(&hit_object.object_params, 0, sizeof(hit_object.object_params));
+                                                _FastOsuParser__ParseHitObject(&i, &scanner, hit_objects_end, flags & ~FastOsuParser__PARSE_CURVE_POINTS, &hit_object, NULL, NULL);
+                                                _FastOsuParser__StatsAdd(&cursor, out, &hit_object);
+                                        }
+                                }
+                                else if (!(flags & FastOsuParser__PARSE_COLUMNS)) {
+                                        size_t ho = 0;
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                                        if (!(flags & FastOsuParser__PARSE_SINGLE_THREAD)) ho = _FastOsuParser__ParseHitObjectsParallel(i, hit_objects_end, flags, out, &curve_points, curve_points_end);
+                                        if (ho != 0) {
+                                                i = hit_objects_end; // (all of this piece, or every hit object)
+                                                if (b_stats) for (size_t parsed = 0; parsed < ho; parsed++) _FastOsuParser__StatsAdd(&cursor, out, &out->hit_objects[parsed]);
+                                        }
+#endif
+                                        for (; ho < out->hit_objects_count; ho++) {
+                                                _FastOsuParser__SkipEmptyLines(&i, &hit_objects_end, &tail, tail_end, &scanner);
+                                                _FastOsuParser__ParseHitObject(&i, &scanner, hit_objects_end, flags, &out->hit_objects[ho], &curve_points, curve_points_end);
+                                                if (b_stats) _FastOsuParser__StatsAdd(&cursor, out, &out->hit_objects[ho]);
+                                        }
+                                }
+                                else {
+                                        for (size_t ho = 0; ho < out->hit_objects_count; ho++) {
+
+                                                // Parse each line, then scatter it straight into the columns & side tables
+                                                FastOsuParser__HitObject hit_object;
+                                                memset(&hit_object.object_params, 0, sizeof(hit_object.object_params));
+                                                _FastOsuParser__SkipEmptyLines(&i, &hit_objects_end, &tail, tail_end, &scanner);
+                                                _FastOsuParser__ParseHitObject(&i, &scanner, hit_objects_end, flags, &hit_object, &curve_points, curve_points_end);
+                                                if (b_stats) _FastOsuParser__StatsAdd(&cursor, out, &hit_object);
+
+                                                out->hit_objects_x[ho] = hit_object.x;
+                                                out->hit_objects_y[ho] = hit_object.y;
+                                                out->hit_objects_time[ho] = hit_object.time;
+                                                out->hit_objects_type[ho] = hit_object.type;
+                                                out->hit_objects_params[ho] = -1;
+
+                                                if ((hit_object.type & 0b00000010) && out->sliders_count < sliders_capacity) {
+                                                        FastOsuParser__Slider* slider = &out->sliders[out->sliders_count];
+                                                        slider->object = ho;
+                                                        slider->curve_type = hit_object.object_params.curve_type;
+                                                        slider->curve_points = hit_object.object_params.curve_points;
+                                                        slider->curve_points_count = hit_object.object_params.curve_points_count;
+                                                        slider->slides = hit_object.object_params.slides;
+                                                        slider->length = hit_object.object_params.length;
+                                                        out->hit_objects_params[ho] = out->sliders_count++;
+                                                }
+                                                else if (hit_object.type & 0b00001000) {
+                                                        FastOsuParser__Spinner* spinner = &out->spinners[out->spinners_count];
+                                                        spinner->object = ho;
+                                                        spinner->end_time = hit_object.object_params.end_time;
+                                                        out->hit_objects_params[ho] = out->spinners_count++;
+                                                }
+
+                                        }
+                                }
+
+                        }
+
+                                goto _FastOsuParser__Parse_END;
+
+                        break;
+
+                }
+
+
+
+                while (*i != '\n') i++; // Skip to beginning of next line (stops in the padding at the latest)
+
+        }
+
+
+
+_FastOsuParser__Parse_END:
+#if defined(FASTOSUPARSER_PROFILE)
+        _FastOsuParser__ProfileSection(&out->profile, profile_section, &profile_start, &profile_start_i, (tail != tail_begin || i >= data+len) ? data+len : i);
+        if (tail != tail_begin) out->profile.section_bytes[profile_section] += tail_end - tail_begin;
+        out->profile.curve_points += curve_points - profile_curve_points;
+#endif
+
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) _FastOsuParser__IndexTiming(out);
+        if (flags & FastOsuParser__PARSE_STATS) _FastOsuParser__StatsFinish(out);
+
+#if defined(FASTOSUPARSER_PROFILE)
+        uint64_t profile_end = _FastOsuParser__Now();
+        out->profile.finish_ns += profile_end - profile_start;
+        out->profile.parse_ns += profile_end - profile_begin;
+#endif
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+// Fills "md5"/"hash" of "out" from "data", as "flags" ask for
+FASTOSUPARSER_DEF void _FastOsuParser__HashBuffer(const char* data, size_t len, int flags, FastOsuParser__Beatmap* out) {
+
+#if defined(FASTOSUPARSER_PROFILE)
+        uint64_t profile_start = _FastOsuParser__Now();
+#endif
+        _FastOsuParser__Hasher hasher;
+        _FastOsuParser__HasherInit(&hasher, flags);
+        _FastOsuParser__HasherUpdate(&hasher, data, len);
+        _FastOsuParser__HasherFinish(&hasher, out);
+#if defined(FASTOSUPARSER_PROFILE)
+        out->profile.hash_ns += _FastOsuParser__Now() - profile_start;
+#endif
+
+}
+
+// Start of the first line of [HitObjects] in ["data", "end"), NULL if there's no such section ('[' only starts section headers)
+FASTOSUPARSER_DEF const char* _FastOsuParser__FindHitObjects(const char* data, const char* end) {
+
+        for (const char* i = data; i < end; i++) {
+                i = (const char*)memchr(i, '[', end-i);
+                if (i == NULL) break;
+                if ((i == data || *(i-1) == '\n') && (size_t)(end-i) >= sizeof("[HitObjects]")-1 && memcmp(i, "[HitObjects]", sizeof("[HitObjects]")-1) == 0) {
+                        const char* newline = (const char*)memchr(i, '\n', end-i);
+                        return (newline == NULL) ? end : newline+1;
+                }
+        }
+
+        return NULL;
+
+}
+
+// Where unpadded "data" can be parsed in place up to, with only the rest copied into a padded buffer (0 = nowhere, copy all of it)
+// That's a line start at least FASTOSUPARSER_PADDING bytes before the end, with a newline after it (so whatever the parser reads past it
+// is still in "data", & stops there), in [HitObjects] with no section header after it: the one section the parser continues into a tail
+FASTOSUPARSER_DEF size_t _FastOsuParser__TailSplit(const char* data, size_t len) {
+
+        if (len <= 2*FASTOSUPARSER_PADDING) return 0;
+
+        size_t split = len - FASTOSUPARSER_PADDING;
+        while (split > 0 && data[split-1] != '\n') split--;
+        if (split != 0 && memchr(data+split, '\n', len-split) == NULL) { // (the last line, without a newline)
+                split--;
+                while (split > 0 && data[split-1] != '\n') split--;
+        }
+        if (split == 0) return 0;
+
+        for (const char* i = data+split; i < data+len; i++) {
+                i = (const char*)memchr(i, '[', data+len-i);
+                if (i == NULL) break;
+                if (*(i-1) == '\n') return 0;
+        }
+
+        const char* section_begin = _FastOsuParser__FindHitObjects(data, data+split);
+        if (section_begin == NULL || section_begin >= data+split) return 0;
+
+        return split;
+
+}
+
+// Parses "data" in place if it's padded, else in place up to its last lines, which are copied into "*buffer" & padded (grown as needed, kept for the caller to reuse)
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ParseBufferPadding(const char* data, size_t len, char b_padded, char** buffer, size_t* buffer_capacity, FastOsuParser__Beatmap* out) {
+
+        int flags = (out->parse_flags == 0) ? FastOsuParser__PARSE_ALL : out->parse_flags;
+
+        if (flags & (FastOsuParser__PARSE_MD5 | FastOsuParser__PARSE_HASH)) _FastOsuParser__HashBuffer(data, len, flags, out);
+
+        if (!b_padded) {
+#if defined(FASTOSUPARSER_PROFILE)
+                uint64_t profile_start = _FastOsuParser__Now();
+#endif
+                size_t split = _FastOsuParser__TailSplit(data, len);
+                size_t tail_size = len - split;
+                if (!_FastOsuParser__ReserveBuffer(buffer, buffer_capacity, tail_size)) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                if (tail_size != 0) memcpy(*buffer, data+split, tail_size);
+                FastOsuParser__Pad(*buffer + tail_size);
+#if defined(FASTOSUPARSER_PROFILE)
+                out->profile.io_ns += _FastOsuParser__Now() - profile_start;
+#endif
+                if (split != 0) return _FastOsuParser__ParseBufferFlags(data, split, flags, NULL, NULL, *buffer, *buffer + tail_size, out);
+                data = *buffer;
+        }
+
+        return _FastOsuParser__ParseBufferFlags(data, len, flags, NULL, NULL, NULL, NULL, out);
+
+}
+
+// Parses "len" bytes of caller-owned memory at "data" (nothing is kept after returning)
+// It's parsed in place but for its last lines, which are copied into a small padded buffer (small files or ones that don't end in [HitObjects] are copied whole),
+// FastOsuParser__ParseBufferPadded() doesn't copy anything
+// Make sure "*out" is 0-initialized (or only has "parse_flags"/"allocator"/"string_pool" set)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ParseBuffer(const char* data, size_t len, FastOsuParser__Beatmap* out) {
+
+        char* buffer = NULL;
+        size_t buffer_capacity = 0;
+        FastOsuParser__Error error = _FastOsuParser__ParseBufferPadding(data, len, 0, &buffer, &buffer_capacity, out);
+        free(buffer);
+
+        return error;
+
+}
+
+// Like FastOsuParser__ParseBuffer(), but parses "data" in place: it must be followed by FASTOSUPARSER_PADDING writable bytes
+// These are overwritten by FastOsuParser__Pad(data+len) (the loaders read every file into such a buffer)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ParseBufferPadded(char* data, size_t len, FastOsuParser__Beatmap* out) {
+
+        FastOsuParser__Pad(data+len);
+
+        return _FastOsuParser__ParseBufferPadding(data, len, 1, NULL, NULL, out);
+
+}
+
+// "time" of the [HitObjects] line at "i" (INT_MAX for empty lines, so they sort last)
+FASTOSUPARSER_DEF long long _FastOsuParser__LineTime(const char* i, const char* end) {
+
+        if (*i == '\r' || *i == '\n') return INT_MAX;
+
+        for (int commas = 0; commas < 2; commas++) {
+                i = (const char*)memchr(i, ',', end-i);
+                if (i == NULL) return INT_MAX;
+                i++;
+        }
+
+        // (from a padded copy, the caller's memory isn't padded)
+        char time[32 + FASTOSUPARSER_PADDING];
+        size_t time_size = ((size_t)(end-i) < 32) ? (size_t)(end-i) : 32;
+        memcpy(time, i, time_size);
+        FastOsuParser__Pad(time + time_size);
+        i = time;
+        return _FastOsuParser__ParseInt(&i);
+
+}
+
+// First line of ["begin", "end") with a "time" at/after "time", by bisecting its bytes (both start lines, which are sorted by time)
+FASTOSUPARSER_DEF const char* _FastOsuParser__LowerBoundLine(const char* begin, const char* end, long long time) {
+
+        while (begin < end) {
+                const char* line = begin + (end-begin)/2;
+                while (line > begin && *(line-1) != '\n') line--; // (back to the start of its line)
+
+                if (_FastOsuParser__LineTime(line, end) < time) {
+                        const char* newline = (const char*)memchr(line, '\n', end-line);
+                        begin = (newline == NULL) ? end : newline+1;
+                }
+                else end = line;
+        }
+
+        return begin;
+
+}
+
+// Like FastOsuParser__ParseBuffer(), but only parses (& allocates) the hit objects with a "time" in ["t0", "t1"] (ms)
+// [HitObjects] lines are sorted by time, so they're found by bisecting the section's bytes, then only the lines in range are decoded
+// (sliders starting before "t0" aren't included, even if they're still going at "t0")
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ParseRange(const char* data, size_t len, int t0, int t1, FastOsuParser__Beatmap* out) {
+
+        int flags = ((out->parse_flags == 0) ? FastOsuParser__PARSE_ALL : out->parse_flags) | FastOsuParser__PARSE_HIT_OBJECTS;
+        const char* end = data+len;
+
+        if (flags & (FastOsuParser__PARSE_MD5 | FastOsuParser__PARSE_HASH)) {
+#if defined(FASTOSUPARSER_PROFILE)
+                uint64_t profile_start = _FastOsuParser__Now();
+#endif
+                _FastOsuParser__Hasher hasher;
+                _FastOsuParser__HasherInit(&hasher, flags);
+                _FastOsuParser__HasherUpdate(&hasher, data, len);
+                _FastOsuParser__HasherFinish(&hasher, out);
+#if defined(FASTOSUPARSER_PROFILE)
+                out->profile.hash_ns += _FastOsuParser__Now() - profile_start;
+#endif
+        }
+
+        const char* section_begin = _FastOsuParser__FindHitObjects(data, end);
+
+        // Bisect it for the lines in range
+        const char* range_begin = NULL;
+        const char* range_end = NULL;
+        size_t header_size = len; // (everything, if there are no hit objects at all)
+        if (section_begin != NULL) {
+                const char* section_end = section_begin;
+                for (;;) { // (up to the next section header, if any)
+                        section_end = (const char*)memchr(section_end, '[', end-section_end);
+                        if (section_end == NULL) {
+                                section_end = end;
+                                break;
+                        }
+                        if (*(section_end-1) == '\n') break;
+                        section_end++;
+                }
+
+                range_begin = _FastOsuParser__LowerBoundLine(section_begin, section_end, t0);
+                range_end = _FastOsuParser__LowerBoundLine(range_begin, section_end, (long long)t1 + 1);
+                header_size = section_begin - data;
+        }
+
+        // Only everything up to [HitObjects] & the lines in range are copied into a padded buffer
+        size_t range_size = range_end - range_begin;
+        char* buffer = (char*)malloc(header_size + range_size + FASTOSUPARSER_PADDING);
+        if (buffer == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        if (header_size != 0) memcpy(buffer, data, header_size);
+        if (range_size != 0) memcpy(buffer + header_size, range_begin, range_size);
+        FastOsuParser__Pad(buffer + header_size + range_size);
+
+        FastOsuParser__Error error = _FastOsuParser__ParseBufferFlags(buffer, header_size + range_size, flags, (section_begin == NULL) ? NULL : buffer + header_size, buffer + header_size + range_size, NULL, NULL, out);
+        free(buffer);
+
+        return error;
+
+}
+
+// Reads the file at "path" into "*buffer", growing it (geometrically) only if it's too small
+// (padded with FastOsuParser__Pad() after the file, "*buffer_capacity" doesn't count the padding)
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ReadFile(const char* path, char** buffer, size_t* buffer_capacity, size_t* size) {
+
+#if defined(__linux__)
+
+        int beatmap_file = open(path, O_RDONLY); //
+        if (beatmap_file == -1) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+
+        struct stat beatmap_file_stat;
+        if (fstat(beatmap_file, &beatmap_file_stat) != 0) {
+                close(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
+        }
+        size_t beatmap_file_size = beatmap_file_stat.st_size; //
+
+#else
+
+        FILE* beatmap_file = fopen(path, "rb"); //
+        if (beatmap_file == NULL) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+
+        if (fseek(beatmap_file, 0, SEEK_END) != 0) {
+                fclose(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_SEEK_FILE_END;
+        }
+        long beatmap_file_size = ftell(beatmap_file); //
+        if (beatmap_file_size == -1L) {
+                fclose(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
+        }
+        if (fseek(beatmap_file, 0, SEEK_SET) != 0) {
+                fclose(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_SEEK_FILE_START;
+        }
+
+#endif
+
+        if (!_FastOsuParser__ReserveBuffer(buffer, buffer_capacity, beatmap_file_size)) {
+#if defined(__linux__)
+                close(beatmap_file);
+#else
+                fclose(beatmap_file);
+#endif
+                return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+
+#if defined(__linux__)
+
+        size_t bytes_read = 0;
+        while (bytes_read < beatmap_file_size) {
+                ssize_t result = pread(beatmap_file, *buffer + bytes_read, beatmap_file_size - bytes_read, bytes_read);
+                if (result <= 0) {
+                        close(beatmap_file);
+                        return FastOsuParser__ERROR_FAILED_TO_READ_FILE;
+                }
+                bytes_read += result;
+        }
+
+        if (close(beatmap_file) != 0) return FastOsuParser__ERROR_FAILED_TO_CLOSE_FILE;
+
+#else
+
+        if (fread(*buffer, 1, beatmap_file_size, beatmap_file) < beatmap_file_size) {
+                fclose(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_READ_FILE;
+        }
+
+        if (fclose(beatmap_file) != 0) return FastOsuParser__ERROR_FAILED_TO_CLOSE_FILE;
+
+#endif
+
+        FastOsuParser__Pad(*buffer + beatmap_file_size);
+        *size = beatmap_file_size;
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+// Make sure "*out" is 0-initialized
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__Parse(char* path, FastOsuParser__Beatmap* out) {
+
+#if defined(FASTOSUPARSER_PROFILE)
+        uint64_t profile_start = _FastOsuParser__Now();
+#endif
+
+#if defined(__linux__) // Map the file instead of copying it into a heap buffer
+
+        int beatmap_file = open(path, O_RDONLY); //
+        if (beatmap_file == -1) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+
+        struct stat beatmap_file_stat;
+        if (fstat(beatmap_file, &beatmap_file_stat) != 0) {
+                close(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
+        }
+        size_t beatmap_file_size = beatmap_file_stat.st_size; //
+        if (beatmap_file_size == 0) {
+                close(beatmap_file);
+                return FastOsuParser__ParseBuffer("", 0, out);
+        }
+
+        // Reserve room for the file & its padding, then map the file over the start of it
+        // (privately & writable, so FastOsuParser__ParseBufferPadded() can pad it, which only copies the file's last page if the padding starts in it)
+        size_t page_size = sysconf(_SC_PAGESIZE);
+        size_t map_size = (beatmap_file_size + FASTOSUPARSER_PADDING + page_size-1) / page_size * page_size;
+        char* beatmap_file_contents = (char*)mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0); //
+        if (beatmap_file_contents == MAP_FAILED) {
+                close(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_MAP_FILE;
+        }
+        if (mmap(beatmap_file_contents, beatmap_file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, beatmap_file, 0) == MAP_FAILED) {
+                munmap(beatmap_file_contents, map_size);
+                close(beatmap_file);
+                return FastOsuParser__ERROR_FAILED_TO_MAP_FILE;
+        }
+        madvise(beatmap_file_contents, beatmap_file_size, MADV_SEQUENTIAL);
+
+        if (close(beatmap_file) != 0) {
+                munmap(beatmap_file_contents, map_size);
+                return FastOsuParser__ERROR_FAILED_TO_CLOSE_FILE;
+        }
+
+#if defined(FASTOSUPARSER_PROFILE)
+        out->profile.io_ns += _FastOsuParser__Now() - profile_start;
+#endif
+
+
+        FastOsuParser__Error error = FastOsuParser__ParseBufferPadded(beatmap_file_contents, beatmap_file_size, out);
+
+        munmap(beatmap_file_contents, map_size);
+
+        return error;
+
+#else
+
+        char* beatmap_file_contents = NULL;
+        size_t beatmap_file_capacity = 0;
+        size_t beatmap_file_size;
+        FastOsuParser__Error error = _FastOsuParser__ReadFile(path, &beatmap_file_contents, &beatmap_file_capacity, &beatmap_file_size);
+#if defined(FASTOSUPARSER_PROFILE)
+        out->profile.io_ns += _FastOsuParser__Now() - profile_start;
+#endif
+        if (error == FastOsuParser__SUCCESS) error = FastOsuParser__ParseBufferPadded(beatmap_file_contents, beatmap_file_size, out);
+
+        free(beatmap_file_contents);
+
+        return error;
+
+#endif
+
+}
+
+FASTOSUPARSER_DEF void FastOsuParser__Free(FastOsuParser__Beatmap* beatmap) {
+
+        if (beatmap->allocator.alloc == NULL) free(beatmap->_arena);
+        else if (beatmap->allocator.free != NULL) beatmap->allocator.free(beatmap->_arena, beatmap->allocator.user);
+
+        free(beatmap->_paths);
+
+}
+
+
+
+// Keeps its file buffer & beatmap arena alive between parses (make sure it's 0-initialized)
+typedef struct {
+        char* buffer;
+        size_t buffer_capacity;
+        void* arena;
+        size_t arena_capacity;
+        FastOsuParser__Beatmap beatmap;
+        int parse_flags; // (optional) What every parse on it parses (FastOsuParser__PARSE_*, like "parse_flags" of a beatmap), 0 = everything
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringPool* string_pool; // (optional) Pool the parsed beatmaps' strings go into
+#endif
+} FastOsuParser__Context;
+
+FASTOSUPARSER_DEF void* _FastOsuParser__ContextAlloc(size_t size, void* user) {
+
+        FastOsuParser__Context* context = (FastOsuParser__Context*)user;
+
+        if (size > context->arena_capacity) {
+                size_t new_capacity = context->arena_capacity * 2;
+                if (new_capacity < size) new_capacity = size;
+
+                free(context->arena);
+                context->arena = malloc(new_capacity);
+                context->arena_capacity = (context->arena == NULL) ? 0 : new_capacity;
+        }
+
+        return context->arena;
+
+}
+
+// Parses "data" (in place if it's padded already, else but for its last lines, which are copied into the context's buffer, see _FastOsuParser__ParseBufferPadding())
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__ContextParseBufferPadding(FastOsuParser__Context* context, const char* data, size_t len, char b_padded, FastOsuParser__Beatmap** out) {
+
+        free(context->beatmap._paths);
+        memset(&context->beatmap, 0, sizeof(context->beatmap));
+        context->beatmap.parse_flags = context->parse_flags;
+        context->beatmap.allocator.alloc = _FastOsuParser__ContextAlloc;
+        context->beatmap.allocator.user = context;
+#if defined(FASTOSUPARSER_STRING_POOL)
+        context->beatmap.string_pool = context->string_pool;
+#endif
+
+        *out = &context->beatmap;
+
+        return _FastOsuParser__ParseBufferPadding(data, len, b_padded, &context->buffer, &context->buffer_capacity, &context->beatmap);
+
+}
+
+// "*out" points to the context's beatmap, valid until the next parse on "context" (don't FastOsuParser__Free() it)
+// "data" is parsed in place but for its last lines, which are copied into the context's (reused) buffer to be padded (small files or ones that don't end in [HitObjects] are copied whole)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ContextParseBuffer(FastOsuParser__Context* context, const char* data, size_t len, FastOsuParser__Beatmap** out) {
+
+        return _FastOsuParser__ContextParseBufferPadding(context, data, len, 0, out);
+
+}
+
+// "*out" points to the context's beatmap, valid until the next parse on "context" (don't FastOsuParser__Free() it)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ContextParse(FastOsuParser__Context* context, char* path, FastOsuParser__Beatmap** out) {
+
+        size_t beatmap_file_size;
+        FastOsuParser__Error error = _FastOsuParser__ReadFile(path, &context->buffer, &context->buffer_capacity, &beatmap_file_size);
+        if (error != FastOsuParser__SUCCESS) return error;
+
+        return _FastOsuParser__ContextParseBufferPadding(context, context->buffer, beatmap_file_size, 1, out);
+
+}
+
+FASTOSUPARSER_DEF void FastOsuParser__ContextFree(FastOsuParser__Context* context) {
+
+        free(context->buffer);
+        free(context->arena);
+        free(context->beatmap._paths);
+
+}
+
+
+
+// Push-style parser for beatmaps that arrive in chunks (sockets, decompressors, ...)
+// Chunks may split lines & fields anywhere, only the end of a chunk (its unfinished line & the lines in its last FASTOSUPARSER_PADDING bytes) is copied & carried over
+// "out->timing_points"/"out->hit_objects" grow as lines come in & stay valid until the next feed
+typedef struct {
+        FastOsuParser__Beatmap* out;
+        void (*on_hit_object)(const FastOsuParser__HitObject* hit_object, void* user); // Optional, called as each hit object is parsed
+        void* user;
+
+        char* buffer; // Lines carried over between chunks (padded)
+        size_t buffer_size;
+        size_t buffer_capacity;
+
+        int flags;
+        int remaining_sections;
+        _FastOsuParser__Section current_section;
+        int current_section_flag;
+
+        size_t timing_points_capacity;
+        size_t hit_objects_capacity;
+        FastOsuParser__CurvePoint* curve_points;
+        size_t curve_points_count;
+        size_t curve_points_capacity;
+
+        _FastOsuParser__Hasher hasher; // (FastOsuParser__PARSE_MD5/_HASH, sees every byte, even after "b_done")
+
+        FastOsuParser__Error error; // Sticky, returned by every later feed
+        int b_done; // Every requested section is finished, the rest of the input is ignored
+} FastOsuParser__Stream;
+
+// Make sure "*out" is 0-initialized (or only has "parse_flags"/"allocator"/"string_pool" set), "on_hit_object"/"user" can be set after this
+FASTOSUPARSER_DEF void FastOsuParser__StreamInit(FastOsuParser__Stream* stream, FastOsuParser__Beatmap* out) {
+
+        memset(stream, 0, sizeof(*stream));
+        stream->out = out;
+        stream->flags = (out->parse_flags == 0) ? FastOsuParser__PARSE_ALL : out->parse_flags;
+        stream->flags &= ~FastOsuParser__PARSE_COLUMNS; // (hit objects are emitted one by one, so always into "hit_objects")
+        if (stream->flags & FastOsuParser__PARSE_STATS) { // (the stream keeps its hit objects, the stats are added up from them at the end)
+                stream->flags |= FastOsuParser__PARSE_DIFFICULTY | FastOsuParser__PARSE_TIMING_POINTS | FastOsuParser__PARSE_HIT_OBJECTS | _FastOsuParser__PARSE_EVENTS;
+        }
+        stream->remaining_sections = stream->flags & (FastOsuParser__PARSE_SECTIONS | (int)_FastOsuParser__PARSE_EVENTS);
+        stream->error = FastOsuParser__SUCCESS;
+        _FastOsuParser__HasherInit(&stream->hasher, stream->flags);
+
+        out->timing_points = NULL;
+        out->timing_points_count = 0;
+        out->hit_objects = NULL;
+        out->hit_objects_count = 0;
+        out->_arena = NULL;
+
+}
+
+// Grows "*array" (geometrically) to hold at least "count" elements
+FASTOSUPARSER_DEF int _FastOsuParser__Reserve(void** array, size_t* capacity, size_t count, size_t element_size) {
+
+        if (count <= *capacity) return 1;
+
+        size_t new_capacity = *capacity * 2;
+        if (new_capacity < count) new_capacity = count;
+        if (new_capacity < 64) new_capacity = 64;
+
+        void* new_array = realloc(*array, new_capacity * element_size);
+        if (new_array == NULL) return 0;
+
+        *array = new_array;
+        *capacity = new_capacity;
+        return 1;
+
+}
+
+// Like _FastOsuParser__Reserve(), but also points the already parsed sliders at the new block
+FASTOSUPARSER_DEF int _FastOsuParser__StreamReserveCurvePoints(FastOsuParser__Stream* stream, size_t count) {
+
+        if (count <= stream->curve_points_capacity) return 1;
+
+        size_t new_capacity = stream->curve_points_capacity * 2;
+        if (new_capacity < count) new_capacity = count;
+        if (new_capacity < 64) new_capacity = 64;
+
+        FastOsuParser__CurvePoint* new_curve_points = (FastOsuParser__CurvePoint*)malloc(new_capacity * sizeof(FastOsuParser__CurvePoint));
+        if (new_curve_points == NULL) return 0;
+
+        if (stream->curve_points_count != 0) memcpy(new_curve_points, stream->curve_points, stream->curve_points_count * sizeof(FastOsuParser__CurvePoint));
+
+        FastOsuParser__Beatmap* out = stream->out;
+        for (size_t ho = 0; ho < out->hit_objects_count; ho++) {
+                FastOsuParser__HitObject* hit_object = &out->hit_objects[ho];
+                if ((hit_object->type & 0b00000010) && hit_object->object_params.curve_points != NULL) {
+                        hit_object->object_params.curve_points = new_curve_points + (hit_object->object_params.curve_points - stream->curve_points);
+                }
+        }
+
+        free(stream->curve_points);
+        stream->curve_points = new_curve_points;
+        stream->curve_points_capacity = new_capacity;
+        return 1;
+
+}
+
+// Parses complete lines in ["i", "end"), "*(end-1)" must be '\n'
+FASTOSUPARSER_DEF void _FastOsuParser__StreamLines(FastOsuParser__Stream* stream, const char* i, const char* end) {
+
+        FastOsuParser__Beatmap* out = stream->out;
+
+        _FastOsuParser__Scanner scanner;
+        int b_scanner = 0; // "scanner" is positioned at "i" (only while inside consecutive timing point/hit object lines)
+
+        while (i < end && !stream->b_done) {
+
+                if (*i == '[') { // If new section:
+
+                        // Finished with the previous section
+                        stream->remaining_sections &= ~stream->current_section_flag;
+                        if (stream->remaining_sections == 0) {
+                                stream->b_done = 1;
+                                return;
+                        }
+
+                        switch (*(i+1)) { // Update current_section state based on first letter
+                                case 'G': stream->current_section = _FastOsuParser__SECTION_GENERAL; stream->current_section_flag = FastOsuParser__PARSE_GENERAL; break;
+                                case 'M': stream->current_section = _FastOsuParser__SECTION_METADATA; stream->current_section_flag = FastOsuParser__PARSE_METADATA; break;
+                                case 'D': stream->current_section = _FastOsuParser__SECTION_DIFFICULTY; stream->current_section_flag = FastOsuParser__PARSE_DIFFICULTY; break;
+                                case 'E': // ([Editor] isn't parsed)
+                                        stream->current_section = (*(i+2) == 'v') ? _FastOsuParser__SECTION_EVENTS : _FastOsuParser__SECTION_NONE;
+                                        stream->current_section_flag = (*(i+2) == 'v') ? _FastOsuParser__PARSE_EVENTS : 0;
+                                break;
+                                case 'T': stream->current_section = _FastOsuParser__SECTION_TIMING_POINTS; stream->current_section_flag = FastOsuParser__PARSE_TIMING_POINTS; break;
+                                case 'H': stream->current_section = _FastOsuParser__SECTION_HIT_OBJECTS; stream->current_section_flag = FastOsuParser__PARSE_HIT_OBJECTS; break;
+                                default: stream->current_section = _FastOsuParser__SECTION_NONE; stream->current_section_flag = 0;
+                        }
+
+                        if (!(stream->flags & stream->current_section_flag)) stream->current_section = _FastOsuParser__SECTION_NONE; // Not requested
+
+                }
+
+                else switch (stream->current_section) {
+
+                        case _FastOsuParser__SECTION_NONE: break;
+
+                        case _FastOsuParser__SECTION_GENERAL:
+                        case _FastOsuParser__SECTION_METADATA:
+                        case _FastOsuParser__SECTION_DIFFICULTY: stream->error = _FastOsuParser__ParseKeyValue(i, out); break;
+                        case _FastOsuParser__SECTION_EVENTS: _FastOsuParser__ParseEvent(i, out); break;
+
+                        case _FastOsuParser__SECTION_TIMING_POINTS:
+
+                                if (*i == '\r' || *i == '\n') { // An empty line ends [TimingPoints]
+                                        stream->current_section = _FastOsuParser__SECTION_NONE;
+                                        stream->current_section_flag = 0;
+                                        stream->remaining_sections &= ~FastOsuParser__PARSE_TIMING_POINTS;
+                                        if (stream->remaining_sections == 0) stream->b_done = 1;
+                                        break;
+                                }
+
+                                if (!_FastOsuParser__Reserve((void**)&out->timing_points, &stream->timing_points_capacity, out->timing_points_count+1, sizeof(FastOsuParser__TimingPoint))) {
+                                        stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                                        return;
+                                }
+
+                                if (!b_scanner) _FastOsuParser__ScannerInit(&scanner, i, end);
+                                _FastOsuParser__ParseTimingPoint(&i, &scanner, end, &out->timing_points[out->timing_points_count++]);
+                                b_scanner = 1;
+                        continue; // (already at the next line)
+
+                        case _FastOsuParser__SECTION_HIT_OBJECTS:
+                        {
+
+                                if (*i == '\r' || *i == '\n') break;
+
+                                if (!_FastOsuParser__Reserve((void**)&out->hit_objects, &stream->hit_objects_capacity, out->hit_objects_count+1, sizeof(FastOsuParser__HitObject))) {
+                                        stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                                        return;
+                                }
+
+                                if (_FASTOSUPARSER_CURVE_POINTS_STORAGE(stream->flags)) {
+                                        // Every curve point takes at least 4 bytes ("x:y|", and edge sounds 6: "0|" & "0:0|"), so this line can't have more than that
+                                        const char* newline = (const char*)memchr(i, '\n', end-i);
+                                        if (!_FastOsuParser__StreamReserveCurvePoints(stream, stream->curve_points_count + (newline-i)/4 + 1)) {
+                                                stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                                                return;
+                                        }
+                                }
+
+                                FastOsuParser__HitObject* hit_object = &out->hit_objects[out->hit_objects_count++];
+                                memset(hit_object, 0, sizeof(*hit_object));
+
+                                FastOsuParser__CurvePoint* curve_points = NULL;
+                                FastOsuParser__CurvePoint* curve_points_end = NULL;
+                                if (stream->curve_points != NULL) {
+                                        curve_points = stream->curve_points + stream->curve_points_count;
+                                        curve_points_end = stream->curve_points + stream->curve_points_capacity;
+                                }
+
+                                if (!b_scanner) _FastOsuParser__ScannerInit(&scanner, i, end);
+                                _FastOsuParser__ParseHitObject(&i, &scanner, end, stream->flags, hit_object, &curve_points, curve_points_end);
+                                b_scanner = 1;
+                                if (stream->curve_points != NULL) stream->curve_points_count = curve_points - stream->curve_points;
+
+                                if (stream->on_hit_object != NULL) stream->on_hit_object(hit_object, stream->user);
+
+                        }
+                        continue; // (already at the next line)
+
+                }
+
+                if (stream->error != FastOsuParser__SUCCESS) return;
+
+                i = (const char*)memchr(i, '\n', end-i) + 1; // Skip to beginning of next line
+                b_scanner = 0;
+
+        }
+
+}
+
+// Appends "len" bytes to the stream's carry-over buffer (kept padded)
+FASTOSUPARSER_DEF int _FastOsuParser__StreamCarry(FastOsuParser__Stream* stream, const char* data, size_t len) {
+
+        if (!_FastOsuParser__Reserve((void**)&stream->buffer, &stream->buffer_capacity, stream->buffer_size+len+FASTOSUPARSER_PADDING, 1)) return 0;
+
+        memcpy(stream->buffer + stream->buffer_size, data, len);
+        stream->buffer_size += len;
+        FastOsuParser__Pad(stream->buffer + stream->buffer_size);
+        return 1;
+
+}
+
+// Parses the next "len" bytes of the beatmap, "data" isn't kept after returning
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__StreamFeed(FastOsuParser__Stream* stream, const char* data, size_t len) {
+
+        if (stream->error != FastOsuParser__SUCCESS) return stream->error;
+
+        if (stream->hasher.flags != 0) _FastOsuParser__HasherUpdate(&stream->hasher, data, len);
+        if (stream->b_done) return FastOsuParser__SUCCESS;
+
+        const char* end = data+len;
+
+        // Finish the line carried over from the previous chunk
+        if (stream->buffer_size != 0) {
+                const char* newline = (const char*)memchr(data, '\n', len);
+                const char* line_end = (newline == NULL) ? end : newline+1;
+
+                if (!_FastOsuParser__StreamCarry(stream, data, line_end-data)) return stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                if (newline == NULL) return FastOsuParser__SUCCESS;
+
+                _FastOsuParser__StreamLines(stream, stream->buffer, stream->buffer + stream->buffer_size);
+                stream->buffer_size = 0;
+                data = line_end;
+        }
+
+        // Parse every complete line in place, except the ones in the last FASTOSUPARSER_PADDING bytes
+        // (the chunk isn't padded, so these are carried over with the unfinished line & parsed from the padded buffer)
+        const char* lines_end = ((size_t)(end-data) > FASTOSUPARSER_PADDING) ? end - FASTOSUPARSER_PADDING : data;
+        while (lines_end > data && *(lines_end-1) != '\n') lines_end--;
+        if (lines_end > data) _FastOsuParser__StreamLines(stream, data, lines_end);
+
+        // Carry over the rest
+        if (stream->error == FastOsuParser__SUCCESS && !stream->b_done && lines_end < end) {
+                if (!_FastOsuParser__StreamCarry(stream, lines_end, end-lines_end)) stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+
+        return stream->error;
+
+}
+
+// Parses whatever is left & moves everything into one block freed by FastOsuParser__Free() (like FastOsuParser__ParseBuffer())
+// Always call this, it releases the stream's own buffers even after an error
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__StreamFinish(FastOsuParser__Stream* stream) {
+
+        FastOsuParser__Beatmap* out = stream->out;
+
+        // The last line doesn't have to end with a newline
+        if (stream->error == FastOsuParser__SUCCESS && !stream->b_done && stream->buffer_size != 0) {
+                if (!_FastOsuParser__StreamCarry(stream, "\n", 1)) stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                else _FastOsuParser__StreamLines(stream, stream->buffer, stream->buffer + stream->buffer_size);
+        }
+
+        size_t arena_size = // (all element types are 8-byte aligned or less, so no padding needed in between)
+                sizeof(FastOsuParser__TimingPoint) * out->timing_points_count +
+                sizeof(FastOsuParser__HitObject) * out->hit_objects_count +
+                sizeof(FastOsuParser__CurvePoint) * stream->curve_points_count;
+        if (stream->flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                arena_size +=
+                        sizeof(FastOsuParser__Timing) * out->timing_points_count +
+                        sizeof(FastOsuParser__HitObjectTiming) * out->hit_objects_count;
+        }
+        if (stream->error == FastOsuParser__SUCCESS && arena_size != 0) {
+                if (out->allocator.alloc != NULL) out->_arena = out->allocator.alloc(arena_size, out->allocator.user);
+                else out->_arena = malloc(arena_size);
+                if (out->_arena == NULL) stream->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+
+        if (stream->error == FastOsuParser__SUCCESS) {
+                if (stream->hasher.flags != 0) _FastOsuParser__HasherFinish(&stream->hasher, out);
+
+                FastOsuParser__TimingPoint* timing_points = (FastOsuParser__TimingPoint*)out->_arena;
+                FastOsuParser__HitObject* hit_objects = (FastOsuParser__HitObject*)(timing_points + out->timing_points_count);
+                FastOsuParser__CurvePoint* curve_points = (FastOsuParser__CurvePoint*)(hit_objects + out->hit_objects_count);
+
+                if (out->timing_points_count != 0) memcpy(timing_points, out->timing_points, sizeof(FastOsuParser__TimingPoint) * out->timing_points_count);
+                if (out->hit_objects_count != 0) memcpy(hit_objects, out->hit_objects, sizeof(FastOsuParser__HitObject) * out->hit_objects_count);
+                if (stream->curve_points_count != 0) memcpy(curve_points, stream->curve_points, sizeof(FastOsuParser__CurvePoint) * stream->curve_points_count);
+
+                for (size_t ho = 0; ho < out->hit_objects_count; ho++) {
+                        if ((hit_objects[ho].type & 0b00000010) && hit_objects[ho].object_params.curve_points != NULL) {
+                                hit_objects[ho].object_params.curve_points = curve_points + (hit_objects[ho].object_params.curve_points - stream->curve_points);
+                        }
+                }
+
+                free(out->timing_points);
+                free(out->hit_objects);
+                out->timing_points = timing_points;
+                out->hit_objects = hit_objects;
+
+                if (stream->flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                        out->timing_index = (FastOsuParser__Timing*)(curve_points + stream->curve_points_count);
+                        out->hit_object_timings = (FastOsuParser__HitObjectTiming*)(out->timing_index + out->timing_points_count);
+                        _FastOsuParser__IndexTiming(out);
+                }
+
+                if (stream->flags & FastOsuParser__PARSE_STATS) {
+                        _FastOsuParser__TimingCursor cursor;
+                        _FastOsuParser__TimingCursorInit(&cursor, out);
+                        for (size_t ho = 0; ho < out->hit_objects_count; ho++) _FastOsuParser__StatsAdd(&cursor, out, &out->hit_objects[ho]);
+                        _FastOsuParser__StatsFinish(out);
+                }
+        }
+        else {
+                free(out->timing_points);
+                free(out->hit_objects);
+                out->timing_points = NULL;
+                out->timing_points_count = 0;
+                out->hit_objects = NULL;
+                out->hit_objects_count = 0;
+        }
+
+        free(stream->curve_points);
+        free(stream->buffer);
+        stream->curve_points = NULL;
+        stream->buffer = NULL;
+
+        return stream->error;
+
+}
+
+
+
+#if defined(FASTOSUPARSER_STRING_POOL)
+static const size_t _FastOsuParser__STRING_FIELDS[] = {
+        offsetof(FastOsuParser__Beatmap, audio_file_name),
+        offsetof(FastOsuParser__Beatmap, title),
+        offsetof(FastOsuParser__Beatmap, title_unicode),
+        offsetof(FastOsuParser__Beatmap, artist),
+        offsetof(FastOsuParser__Beatmap, artist_unicode),
+        offsetof(FastOsuParser__Beatmap, creator),
+        offsetof(FastOsuParser__Beatmap, version),
+        offsetof(FastOsuParser__Beatmap, source),
+        offsetof(FastOsuParser__Beatmap, tags)
+};
+#endif
+
+// Binary cache file: header, then the beatmap struct, timing points, hit objects, curve points & metadata strings back to back
+// Only offsets are stored, so a cache is loaded by mapping it, without touching the objects
+// (it's meant for the machine that wrote it, caches from another build/architecture are rejected as invalid)
+#define _FASTOSUPARSER_CACHE_VERSION 5
+
+#define _FASTOSUPARSER_CACHE_FIELDS ( \
+        _FASTOSUPARSER_CACHE_FIELD_HIT_SOUNDS << 0 | \
+        _FASTOSUPARSER_CACHE_FIELD_TIMING_POINT_SAMPLES << 1 | \
+        _FASTOSUPARSER_CACHE_FIELD_HOLD_NOTES << 2 \
+)
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+#define _FASTOSUPARSER_CACHE_FIELD_HIT_SOUNDS 1
+#else
+#define _FASTOSUPARSER_CACHE_FIELD_HIT_SOUNDS 0
+#endif
+#if defined(FASTOSUPARSER_TIMING_POINT_SAMPLES)
+#define _FASTOSUPARSER_CACHE_FIELD_TIMING_POINT_SAMPLES 1
+#else
+#define _FASTOSUPARSER_CACHE_FIELD_TIMING_POINT_SAMPLES 0
+#endif
+#if defined(FASTOSUPARSER_HOLD_NOTES)
+#define _FASTOSUPARSER_CACHE_FIELD_HOLD_NOTES 1
+#else
+#define _FASTOSUPARSER_CACHE_FIELD_HOLD_NOTES 0
+#endif
+
+// Hit object "ho" of "beatmap" (from "hit_objects" or the columns), "*b_params" = whether it has slider/spinner params
+FASTOSUPARSER_DEF FastOsuParser__HitObject _FastOsuParser__GetHitObject(const FastOsuParser__Beatmap* beatmap, size_t ho, int* b_params) {
+
+        FastOsuParser__HitObject hit_object;
+        if (beatmap->hit_objects != NULL) {
+                hit_object = beatmap->hit_objects[ho];
+                *b_params = (hit_object.type & 0b00001010) != 0;
+                return hit_object;
+        }
+
+        memset(&hit_object, 0, sizeof(hit_object));
+        hit_object.x = beatmap->hit_objects_x[ho];
+        hit_object.y = beatmap->hit_objects_y[ho];
+        hit_object.time = beatmap->hit_objects_time[ho];
+        hit_object.type = beatmap->hit_objects_type[ho];
+        int params = beatmap->hit_objects_params[ho];
+        *b_params = (hit_object.type & 0b00001010) && params != -1;
+        if (*b_params && (hit_object.type & 0b00000010)) {
+                const FastOsuParser__Slider* slider = &beatmap->sliders[params];
+                hit_object.object_params.curve_type = slider->curve_type;
+                hit_object.object_params.curve_points = slider->curve_points;
+                hit_object.object_params.curve_points_count = slider->curve_points_count;
+                hit_object.object_params.slides = slider->slides;
+                hit_object.object_params.length = slider->length;
+        }
+        else if (*b_params) hit_object.object_params.end_time = beatmap->spinners[params].end_time;
+
+        return hit_object;
+
+}
+
+typedef struct {
+        char magic[4]; // "FOPC"
+        uint32_t version;
+        uint32_t endianness; // 0x01020304 as written
+        uint32_t beatmap_size; // sizeof()s of the structs as written
+        uint32_t timing_point_size;
+        uint32_t hit_object_size;
+        uint32_t curve_point_size;
+        uint32_t fields; // Optional fields built in (_FASTOSUPARSER_CACHE_FIELDS, some don't change the sizes)
+        uint64_t source_size; // Stamp of the .osu file it was made from
+        int64_t source_mtime; // (ns, -1 if unknown)
+        uint64_t source_hash;
+        uint64_t payload_hash; // Of everything after the header
+        uint64_t timing_points_count;
+        uint64_t hit_objects_count;
+        uint64_t curve_points_count;
+        uint64_t strings_size; // (FASTOSUPARSER_STRING_POOL, the beatmap's strings as a read-only pool of their own)
+} _FastOsuParser__CacheHeader;
+
+// Hit object of a cache view: like FastOsuParser__HitObject, but a slider's curve points are an index into the view's "curve_points" (a file can't hold pointers)
+typedef struct {
+        int x;
+        int y;
+        int time;
+        int type;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        unsigned char hit_sound;
+        unsigned char normal_set;
+        unsigned char addition_set;
+        unsigned char volume;
+        int sample_index;
+#endif
+        union {
+                // slider
+                struct {
+                        char curve_type;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                        int edge_sounds_count;
+#endif
+                        size_t curve_points_index; // See FastOsuParser__CacheCurvePoints()
+                        size_t curve_points_count;
+                        int slides;
+                        double length;
+                };
+
+                // spinner (and osu!mania hold note with FASTOSUPARSER_HOLD_NOTES)
+                int end_time;
+        } object_params;
+} FastOsuParser__CachedHitObject;
+
+// A cached beatmap, loaded by FastOsuParser__CacheLoad()
+typedef struct {
+        FastOsuParser__Beatmap beatmap; // Everything but the hit objects (so without any), arrays point into the cache file (don't FastOsuParser__Free() it)
+        const FastOsuParser__CachedHitObject* hit_objects; // (rows, whichever layout they were parsed into)
+        size_t hit_objects_count;
+        const FastOsuParser__CurvePoint* curve_points; // All sliders' curve points, see FastOsuParser__CacheCurvePoints()
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringPool strings; // "beatmap.string_pool" (read-only, points into the cache file)
+#endif
+        void* _data;
+        size_t _size;
+} FastOsuParser__CacheView;
+
+// Curve points of a slider of a cache view ("object_params.curve_points_count" of them)
+FASTOSUPARSER_DEF const FastOsuParser__CurvePoint* FastOsuParser__CacheCurvePoints(const FastOsuParser__CacheView* view, const FastOsuParser__CachedHitObject* hit_object) {
+        return view->curve_points + hit_object->object_params.curve_points_index;
+}
+
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+// Edge sounds of a slider of a cache view (like FastOsuParser__EdgeSounds())
+FASTOSUPARSER_DEF const FastOsuParser__EdgeSound* FastOsuParser__CacheEdgeSounds(const FastOsuParser__CacheView* view, const FastOsuParser__CachedHitObject* hit_object) {
+        return (const FastOsuParser__EdgeSound*)(FastOsuParser__CacheCurvePoints(view, hit_object) + hit_object->object_params.curve_points_count);
+}
+#endif
+
+// Size & modification time (-1 if unknown) of the file at "path"
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__FileStamp(const char* path, uint64_t* size, int64_t* mtime) {
+
+#if defined(__linux__)
+
+        struct stat file_stat;
+        if (stat(path, &file_stat) != 0) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+
+        *size = file_stat.st_size;
+        *mtime = (int64_t)file_stat.st_mtim.tv_sec * 1000000000 + file_stat.st_mtim.tv_nsec;
+
+#else
+
+        FILE* file = fopen(path, "rb");
+        if (file == NULL) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+        if (fseek(file, 0, SEEK_END) != 0) {
+                fclose(file);
+                return FastOsuParser__ERROR_FAILED_TO_SEEK_FILE_END;
+        }
+        long file_size = ftell(file);
+        fclose(file);
+        if (file_size < 0) return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
+
+        *size = file_size;
+        *mtime = -1;
+
+#endif
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+// Hash of the contents of the file at "path"
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__FileHash(const char* path, uint64_t* hash) {
+
+        char* buffer = NULL;
+        size_t buffer_capacity = 0;
+        size_t size;
+        FastOsuParser__Error error = _FastOsuParser__ReadFile(path, &buffer, &buffer_capacity, &size);
+        if (error == FastOsuParser__SUCCESS) *hash = _FastOsuParser__Hash64(buffer, size, 0);
+
+        free(buffer);
+
+        return error;
+
+}
+
+// Writes "beatmap" (parsed from "source_path") to a cache file at "cache_path", replacing it atomically
+// (hit objects from "hit_objects" or the columns, which have no hit sounds)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__CacheWrite(const FastOsuParser__Beatmap* beatmap, const char* source_path, const char* cache_path) {
+
+        _FastOsuParser__CacheHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, "FOPC", 4);
+        header.version = _FASTOSUPARSER_CACHE_VERSION;
+        header.endianness = 0x01020304;
+        header.beatmap_size = sizeof(FastOsuParser__Beatmap);
+        header.timing_point_size = sizeof(FastOsuParser__TimingPoint);
+        header.hit_object_size = sizeof(FastOsuParser__CachedHitObject);
+        header.curve_point_size = sizeof(FastOsuParser__CurvePoint);
+        header.fields = _FASTOSUPARSER_CACHE_FIELDS;
+        header.timing_points_count = beatmap->timing_points_count;
+        header.hit_objects_count = (beatmap->hit_objects != NULL || beatmap->hit_objects_x != NULL) ? beatmap->hit_objects_count : 0; // (only counted with FastOsuParser__PARSE_STATS alone)
+
+        FastOsuParser__Error error = _FastOsuParser__FileStamp(source_path, &header.source_size, &header.source_mtime);
+        if (error != FastOsuParser__SUCCESS) return error;
+        error = _FastOsuParser__FileHash(source_path, &header.source_hash);
+        if (error != FastOsuParser__SUCCESS) return error;
+
+        for (size_t ho = 0; ho < header.hit_objects_count; ho++) {
+                int b_params;
+                FastOsuParser__HitObject hit_object = _FastOsuParser__GetHitObject(beatmap, ho, &b_params);
+                if ((hit_object.type & 0b00000010) && b_params && hit_object.object_params.curve_points != NULL) header.curve_points_count += _FastOsuParser__CurvePointsStorage(&hit_object);
+        }
+
+#if defined(FASTOSUPARSER_STRING_POOL)
+        for (size_t n = 0; n < sizeof(_FastOsuParser__STRING_FIELDS) / sizeof(_FastOsuParser__STRING_FIELDS[0]); n++) {
+                const FastOsuParser__StringView* field = (const FastOsuParser__StringView*)((const char*)beatmap + _FastOsuParser__STRING_FIELDS[n]);
+                if (field->size != 0) header.strings_size += field->size+1;
+        }
+#endif
+
+        // Lay the payload out in memory first (all element types are 8-byte aligned or less, and so are their array sizes, strings go last)
+        size_t payload_size =
+                sizeof(FastOsuParser__Beatmap) +
+                sizeof(FastOsuParser__TimingPoint) * header.timing_points_count +
+                sizeof(FastOsuParser__CachedHitObject) * header.hit_objects_count +
+                sizeof(FastOsuParser__CurvePoint) * header.curve_points_count +
+                header.strings_size;
+        char* payload = (char*)calloc(1, payload_size); // (0s in the padding, for the hash)
+        if (payload == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+
+        FastOsuParser__Beatmap* cached_beatmap = (FastOsuParser__Beatmap*)payload;
+        memcpy(cached_beatmap, beatmap, sizeof(FastOsuParser__Beatmap));
+        cached_beatmap->timing_points = NULL;
+        cached_beatmap->hit_objects = NULL;
+        cached_beatmap->hit_objects_count = 0;
+        cached_beatmap->hit_objects_x = NULL;
+        cached_beatmap->hit_objects_y = NULL;
+        cached_beatmap->hit_objects_time = NULL;
+        cached_beatmap->hit_objects_type = NULL;
+        cached_beatmap->hit_objects_params = NULL;
+        cached_beatmap->sliders = NULL;
+        cached_beatmap->sliders_count = 0;
+        cached_beatmap->spinners = NULL;
+        cached_beatmap->spinners_count = 0;
+        cached_beatmap->timing_index = NULL;
+        cached_beatmap->hit_object_timings = NULL;
+        cached_beatmap->slider_paths = NULL;
+        cached_beatmap->slider_paths_count = 0;
+        cached_beatmap->_paths = NULL;
+        memset(&cached_beatmap->allocator, 0, sizeof(cached_beatmap->allocator));
+#if defined(FASTOSUPARSER_STRING_POOL)
+        cached_beatmap->string_pool = NULL;
+#endif
+        cached_beatmap->_arena = NULL;
+
+        FastOsuParser__TimingPoint* timing_points = (FastOsuParser__TimingPoint*)(cached_beatmap + 1);
+        FastOsuParser__CachedHitObject* hit_objects = (FastOsuParser__CachedHitObject*)(timing_points + header.timing_points_count);
+        FastOsuParser__CurvePoint* curve_points = (FastOsuParser__CurvePoint*)(hit_objects + header.hit_objects_count);
+
+        if (header.timing_points_count != 0) memcpy(timing_points, beatmap->timing_points, sizeof(FastOsuParser__TimingPoint) * header.timing_points_count);
+
+        // Hit objects as rows, with all curve points flattened into one array (sliders point at theirs by index)
+        size_t curve_points_count = 0;
+        for (size_t ho = 0; ho < header.hit_objects_count; ho++) {
+                int b_params;
+                FastOsuParser__HitObject hit_object = _FastOsuParser__GetHitObject(beatmap, ho, &b_params);
+                FastOsuParser__CachedHitObject* cached_hit_object = &hit_objects[ho];
+                cached_hit_object->x = hit_object.x;
+                cached_hit_object->y = hit_object.y;
+                cached_hit_object->time = hit_object.time;
+                cached_hit_object->type = hit_object.type;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                cached_hit_object->hit_sound = hit_object.hit_sound;
+                cached_hit_object->normal_set = hit_object.normal_set;
+                cached_hit_object->addition_set = hit_object.addition_set;
+                cached_hit_object->volume = hit_object.volume;
+                cached_hit_object->sample_index = hit_object.sample_index;
+#endif
+
+                if (!(hit_object.type & 0b00000010)) {
+                        cached_hit_object->object_params.end_time = hit_object.object_params.end_time;
+                        continue;
+                }
+                if (!b_params) continue;
+
+                cached_hit_object->object_params.curve_type = hit_object.object_params.curve_type;
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+                cached_hit_object->object_params.edge_sounds_count = hit_object.object_params.edge_sounds_count;
+#endif
+                cached_hit_object->object_params.curve_points_index = curve_points_count;
+                cached_hit_object->object_params.curve_points_count = hit_object.object_params.curve_points_count;
+                cached_hit_object->object_params.slides = hit_object.object_params.slides;
+                cached_hit_object->object_params.length = hit_object.object_params.length;
+                if (hit_object.object_params.curve_points != NULL) {
+                        size_t storage = _FastOsuParser__CurvePointsStorage(&hit_object); // (with the edge sounds after them)
+                        memcpy(curve_points + curve_points_count, hit_object.object_params.curve_points, sizeof(FastOsuParser__CurvePoint) * storage);
+                        curve_points_count += storage;
+                }
+                else cached_hit_object->object_params.curve_points_count = 0;
+        }
+
+#if defined(FASTOSUPARSER_STRING_POOL)
+        // Copy the strings out of the (shared) pool & point the fields at the copies
+        char* strings = (char*)(curve_points + header.curve_points_count);
+        uint32_t strings_size = 0;
+        for (size_t n = 0; n < sizeof(_FastOsuParser__STRING_FIELDS) / sizeof(_FastOsuParser__STRING_FIELDS[0]); n++) {
+                FastOsuParser__StringView* field = (FastOsuParser__StringView*)((char*)cached_beatmap + _FastOsuParser__STRING_FIELDS[n]);
+                if (field->size == 0) continue;
+                memcpy(strings + strings_size, beatmap->string_pool->data + field->offset, field->size+1);
+                field->offset = strings_size;
+                strings_size += field->size+1;
+        }
+#endif
+
+        header.payload_hash = _FastOsuParser__Hash64(payload, payload_size, 0);
+
+
+
+        // Write it next to the cache file, then move it over (so readers never see a half-written cache)
+        size_t cache_path_size = strlen(cache_path);
+        char* temporary_path = (char*)malloc(cache_path_size + sizeof(".tmp"));
+        if (temporary_path == NULL) {
+                free(payload);
+                return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+        memcpy(temporary_path, cache_path, cache_path_size);
+        memcpy(temporary_path + cache_path_size, ".tmp", sizeof(".tmp"));
+
+        FILE* cache_file = fopen(temporary_path, "wb");
+        if (cache_file == NULL) error = FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+        else {
+                if (fwrite(&header, sizeof(header), 1, cache_file) != 1 || fwrite(payload, 1, payload_size, cache_file) != payload_size) error = FastOsuParser__ERROR_FAILED_TO_WRITE_FILE;
+                if (fclose(cache_file) != 0 && error == FastOsuParser__SUCCESS) error = FastOsuParser__ERROR_FAILED_TO_CLOSE_FILE;
+
+#if defined(_WIN32)
+                if (error == FastOsuParser__SUCCESS) remove(cache_path); // (rename() doesn't replace files on Windows)
+#endif
+                if (error == FastOsuParser__SUCCESS && rename(temporary_path, cache_path) != 0) error = FastOsuParser__ERROR_FAILED_TO_WRITE_FILE;
+                if (error != FastOsuParser__SUCCESS) remove(temporary_path);
+        }
+
+        free(temporary_path);
+        free(payload);
+
+        return error;
+
+}
+
+FASTOSUPARSER_DEF void FastOsuParser__CacheClose(FastOsuParser__CacheView* view) {
+
+#if defined(__linux__)
+        if (view->_data != NULL) munmap(view->_data, view->_size);
+#else
+        free(view->_data);
+#endif
+
+        memset(view, 0, sizeof(*view));
+
+}
+
+// Loads the cache file at "cache_path" into "*out" (free it with FastOsuParser__CacheClose())
+// If "source_path" isn't NULL, the cache has to have been made from that file's current contents (else FastOsuParser__ERROR_CACHE_STALE),
+// which is decided by its size & modification time, and only hashed when the size matches but the time doesn't
+// "b_verify" also checksums the cache itself (reads all of it, so it's off for fast startup)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__CacheLoad(const char* cache_path, const char* source_path, int b_verify, FastOsuParser__CacheView* out) {
+
+        memset(out, 0, sizeof(*out));
+
+#if defined(__linux__) // Map the file, nothing in it needs fixing up
+
+        int cache_file = open(cache_path, O_RDONLY); //
+        if (cache_file == -1) return FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+
+        struct stat cache_file_stat;
+        if (fstat(cache_file, &cache_file_stat) != 0) {
+                close(cache_file);
+                return FastOsuParser__ERROR_FAILED_TO_TELL_FILE;
+        }
+        size_t cache_file_size = cache_file_stat.st_size; //
+        if (cache_file_size < sizeof(_FastOsuParser__CacheHeader) + sizeof(FastOsuParser__Beatmap)) {
+                close(cache_file);
+                return FastOsuParser__ERROR_CACHE_INVALID;
+        }
+
+        void* cache_file_contents = mmap(NULL, cache_file_size, PROT_READ, MAP_PRIVATE, cache_file, 0); //
+        close(cache_file);
+        if (cache_file_contents == MAP_FAILED) return FastOsuParser__ERROR_FAILED_TO_MAP_FILE;
+
+#else
+
+        char* cache_file_contents = NULL;
+        size_t cache_file_capacity = 0;
+        size_t cache_file_size;
+        FastOsuParser__Error read_error = _FastOsuParser__ReadFile(cache_path, &cache_file_contents, &cache_file_capacity, &cache_file_size);
+        if (read_error != FastOsuParser__SUCCESS) {
+                free(cache_file_contents);
+                return read_error;
+        }
+
+#endif
+
+        out->_data = cache_file_contents;
+        out->_size = cache_file_size;
+
+        const _FastOsuParser__CacheHeader* header = (const _FastOsuParser__CacheHeader*)cache_file_contents;
+        const char* payload = (const char*)(header + 1);
+        size_t payload_size = cache_file_size - sizeof(_FastOsuParser__CacheHeader);
+
+        FastOsuParser__Error error = FastOsuParser__SUCCESS;
+
+        // Written by this version & build?
+        if (cache_file_size < sizeof(_FastOsuParser__CacheHeader) + sizeof(FastOsuParser__Beatmap) ||
+            memcmp(header->magic, "FOPC", 4) != 0 ||
+            header->version != _FASTOSUPARSER_CACHE_VERSION ||
+            header->endianness != 0x01020304 ||
+            header->beatmap_size != sizeof(FastOsuParser__Beatmap) ||
+            header->timing_point_size != sizeof(FastOsuParser__TimingPoint) ||
+            header->hit_object_size != sizeof(FastOsuParser__CachedHitObject) ||
+            header->curve_point_size != sizeof(FastOsuParser__CurvePoint) ||
+            header->fields != _FASTOSUPARSER_CACHE_FIELDS ||
+            header->timing_points_count > payload_size / sizeof(FastOsuParser__TimingPoint) || // (so the size check below can't overflow)
+            header->hit_objects_count > payload_size / sizeof(FastOsuParser__CachedHitObject) ||
+            header->curve_points_count > payload_size / sizeof(FastOsuParser__CurvePoint) ||
+            header->strings_size > payload_size ||
+            payload_size !=
+                sizeof(FastOsuParser__Beatmap) +
+                sizeof(FastOsuParser__TimingPoint) * header->timing_points_count +
+                sizeof(FastOsuParser__CachedHitObject) * header->hit_objects_count +
+                sizeof(FastOsuParser__CurvePoint) * header->curve_points_count +
+                header->strings_size) error = FastOsuParser__ERROR_CACHE_INVALID;
+
+        else if (b_verify && _FastOsuParser__Hash64(payload, payload_size, 0) != header->payload_hash) error = FastOsuParser__ERROR_CACHE_INVALID;
+
+        // Made from the source file as it is now?
+        else if (source_path != NULL) {
+                uint64_t source_size;
+                int64_t source_mtime;
+                error = _FastOsuParser__FileStamp(source_path, &source_size, &source_mtime);
+                if (error == FastOsuParser__SUCCESS) {
+                        if (source_size != header->source_size) error = FastOsuParser__ERROR_CACHE_STALE;
+                        else if (source_mtime == -1 || source_mtime != header->source_mtime) {
+                                uint64_t source_hash;
+                                error = _FastOsuParser__FileHash(source_path, &source_hash);
+                                if (error == FastOsuParser__SUCCESS && source_hash != header->source_hash) error = FastOsuParser__ERROR_CACHE_STALE;
+                        }
+                }
+        }
+
+        if (error != FastOsuParser__SUCCESS) {
+                FastOsuParser__CacheClose(out);
+                return error;
+        }
+
+        memcpy(&out->beatmap, payload, sizeof(FastOsuParser__Beatmap));
+        out->beatmap.timing_points = (FastOsuParser__TimingPoint*)(payload + sizeof(FastOsuParser__Beatmap));
+        out->hit_objects = (const FastOsuParser__CachedHitObject*)(out->beatmap.timing_points + header->timing_points_count);
+        out->hit_objects_count = header->hit_objects_count;
+        out->curve_points = (const FastOsuParser__CurvePoint*)(out->hit_objects + header->hit_objects_count);
+#if defined(FASTOSUPARSER_STRING_POOL)
+        out->strings.data = (char*)(out->curve_points + header->curve_points_count);
+        out->strings.size = header->strings_size;
+        out->strings.capacity = header->strings_size;
+        out->beatmap.string_pool = &out->strings;
+#endif
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+
+
+#define _FASTOSUPARSER_PI 3.14159265358979323846
+
+// Builds flattened slider paths (all of a beatmap's are appended to the same arrays)
+typedef struct {
+        FastOsuParser__PathPoint* points;
+        size_t points_count;
+        size_t points_capacity;
+        float* lengths; // (as many as "points")
+        size_t lengths_capacity;
+        size_t path_begin; // First point of the path being built
+
+        FastOsuParser__PathPoint* control_points; // Of the slider being built, starting with its head
+        size_t control_points_capacity;
+        FastOsuParser__PathPoint* bezier; // Bezier subdivision buffers & stack
+        size_t bezier_capacity;
+
+        int b_failed; // Ran out of memory
+} _FastOsuParser__PathBuilder;
+
+FASTOSUPARSER_DEF void _FastOsuParser__PathAdd(_FastOsuParser__PathBuilder* builder, float x, float y) {
+
+        if (builder->points_count > builder->path_begin) { // Zero-length segments don't change the path
+                FastOsuParser__PathPoint* last = &builder->points[builder->points_count-1];
+                if (last->x == x && last->y == y) return;
+        }
+
+        if (!_FastOsuParser__Reserve((void**)&builder->points, &builder->points_capacity, builder->points_count+1, sizeof(FastOsuParser__PathPoint))) {
+                builder->b_failed = 1;
+                return;
+        }
+
+        builder->points[builder->points_count].x = x;
+        builder->points[builder->points_count].y = y;
+        builder->points_count++;
+
+}
+
+// Splits "points" in half (de Casteljau), "midpoints" can be "right"
+FASTOSUPARSER_DEF void _FastOsuParser__BezierSubdivide(const FastOsuParser__PathPoint* points, FastOsuParser__PathPoint* left, FastOsuParser__PathPoint* right, FastOsuParser__PathPoint* midpoints, size_t count) {
+
+        memmove(midpoints, points, sizeof(FastOsuParser__PathPoint) * count);
+
+        for (size_t i = 0; i < count; i++) {
+                left[i] = midpoints[0];
+                right[count-i-1] = midpoints[count-i-1];
+
+                for (size_t j = 0; j+1 < count-i; j++) {
+                        midpoints[j].x = (midpoints[j].x + midpoints[j+1].x) / 2;
+                        midpoints[j].y = (midpoints[j].y + midpoints[j+1].y) / 2;
+                }
+        }
+
+}
+
+// Bezier curve through "count" control points as line segments (subdivided until flat to within 0.25 px, like osu!)
+FASTOSUPARSER_DEF void _FastOsuParser__PathBezier(_FastOsuParser__PathBuilder* builder, const FastOsuParser__PathPoint* control_points, size_t count) {
+
+        if (count <= 2) {
+                for (size_t i = 0; i < count; i++) _FastOsuParser__PathAdd(builder, control_points[i].x, control_points[i].y);
+                return;
+        }
+
+        // [midpoints: count][left: 2*count-1][stack: depth*count]
+        size_t depth = 1;
+        if (!_FastOsuParser__Reserve((void**)&builder->bezier, &builder->bezier_capacity, 4*count, sizeof(FastOsuParser__PathPoint))) {
+                builder->b_failed = 1;
+                return;
+        }
+        memcpy(builder->bezier + 3*count-1, control_points, sizeof(FastOsuParser__PathPoint) * count);
+
+        while (depth > 0) {
+
+                FastOsuParser__PathPoint* midpoints = builder->bezier;
+                FastOsuParser__PathPoint* left = midpoints + count;
+                FastOsuParser__PathPoint* parent = left + 2*count-1 + (depth-1)*count;
+
+                char b_flat = 1;
+                for (size_t i = 1; i+1 < count; i++) {
+                        float x = parent[i-1].x - 2*parent[i].x + parent[i+1].x;
+                        float y = parent[i-1].y - 2*parent[i].y + parent[i+1].y;
+                        if (x*x + y*y > 0.25f * 0.25f * 4) {
+                                b_flat = 0;
+                                break;
+                        }
+                }
+
+                if (b_flat) {
+                        // Add the flat piece, smoothed through its subdivided control points
+                        FastOsuParser__PathPoint* right = midpoints;
+                        _FastOsuParser__BezierSubdivide(parent, left, right, midpoints, count);
+                        for (size_t i = 0; i+1 < count; i++) left[count+i] = right[i+1];
+
+                        _FastOsuParser__PathAdd(builder, parent[0].x, parent[0].y);
+                        for (size_t i = 1; i+1 < count; i++) {
+                                _FastOsuParser__PathAdd(builder,
+                                        0.25f * (left[2*i-1].x + 2*left[2*i].x + left[2*i+1].x),
+                                        0.25f * (left[2*i-1].y + 2*left[2*i].y + left[2*i+1].y)
+                                );
+                        }
+
+                        depth--;
+                        continue;
+                }
+
+                if (!_FastOsuParser__Reserve((void**)&builder->bezier, &builder->bezier_capacity, 3*count-1 + (depth+1)*count, sizeof(FastOsuParser__PathPoint))) {
+                        builder->b_failed = 1;
+                        return;
+                }
+                midpoints = builder->bezier;
+                left = midpoints + count;
+                parent = left + 2*count-1 + (depth-1)*count;
+                FastOsuParser__PathPoint* top = parent + count;
+
+                // Replace the parent by its right half & push its left half (so that one is flattened first)
+                _FastOsuParser__BezierSubdivide(parent, left, top, midpoints, count);
+                memcpy(parent, top, sizeof(FastOsuParser__PathPoint) * count);
+                memcpy(top, left, sizeof(FastOsuParser__PathPoint) * count);
+                depth++;
+
+        }
+
+        _FastOsuParser__PathAdd(builder, control_points[count-1].x, control_points[count-1].y);
+
+}
+
+// Bezier segments of a legacy slider are separated by repeated control points ("red anchors")
+FASTOSUPARSER_DEF void _FastOsuParser__PathBezierSegments(_FastOsuParser__PathBuilder* builder, const FastOsuParser__PathPoint* control_points, size_t count) {
+
+        size_t segment_begin = 0;
+        for (size_t i = 1; i <= count; i++) {
+                if (i == count || (control_points[i].x == control_points[i-1].x && control_points[i].y == control_points[i-1].y)) {
+                        _FastOsuParser__PathBezier(builder, control_points + segment_begin, i - segment_begin);
+                        segment_begin = i;
+                }
+        }
+
+}
+
+// Catmull-Rom spline through the control points (50 segments in between each, like osu!)
+FASTOSUPARSER_DEF void _FastOsuParser__PathCatmull(_FastOsuParser__PathBuilder* builder, const FastOsuParser__PathPoint* control_points, size_t count) {
+
+        if (count == 1) _FastOsuParser__PathAdd(builder, control_points[0].x, control_points[0].y);
+
+        for (size_t i = 0; i+1 < count; i++) {
+                FastOsuParser__PathPoint v1 = (i > 0) ? control_points[i-1] : control_points[i];
+                FastOsuParser__PathPoint v2 = control_points[i];
+                FastOsuParser__PathPoint v3 = control_points[i+1];
+                FastOsuParser__PathPoint v4;
+                if (i+2 < count) v4 = control_points[i+2];
+                else {
+                        v4.x = v3.x + v3.x - v2.x;
+                        v4.y = v3.y + v3.y - v2.y;
+                }
+
+                for (int c = 0; c <= 50; c++) {
+                        float t = (float)c / 50;
+                        float t2 = t*t;
+                        float t3 = t*t2;
+                        _FastOsuParser__PathAdd(builder,
+                                0.5f * (2*v2.x + (-v1.x + v3.x) * t + (2*v1.x - 5*v2.x + 4*v3.x - v4.x) * t2 + (-v1.x + 3*v2.x - 3*v3.x + v4.x) * t3),
+                                0.5f * (2*v2.y + (-v1.y + v3.y) * t + (2*v1.y - 5*v2.y + 4*v3.y - v4.y) * t2 + (-v1.y + 3*v2.y - 3*v3.y + v4.y) * t3)
+                        );
+                }
+        }
+
+}
+
+// Arc through 3 control points (0 if they're (almost) on a line)
+FASTOSUPARSER_DEF int _FastOsuParser__PathCircle(_FastOsuParser__PathBuilder* builder, const FastOsuParser__PathPoint* control_points) {
+
+        FastOsuParser__PathPoint a = control_points[0];
+        FastOsuParser__PathPoint b = control_points[1];
+        FastOsuParser__PathPoint c = control_points[2];
+
+        float d = 2 * (a.x * (b.y - c.y) + b.x * (c.y - a.y) + c.x * (a.y - b.y));
+        if (d > -1e-3f && d < 1e-3f) return 0;
+
+        float a_squared = a.x*a.x + a.y*a.y;
+        float b_squared = b.x*b.x + b.y*b.y;
+        float c_squared = c.x*c.x + c.y*c.y;
+        float centre_x = (a_squared * (b.y - c.y) + b_squared * (c.y - a.y) + c_squared * (a.y - b.y)) / d;
+        float centre_y = (a_squared * (c.x - b.x) + b_squared * (a.x - c.x) + c_squared * (b.x - a.x)) / d;
+
+        float radius = sqrtf((a.x - centre_x) * (a.x - centre_x) + (a.y - centre_y) * (a.y - centre_y));
+        double theta_start = atan2(a.y - centre_y, a.x - centre_x);
+        double theta_end = atan2(c.y - centre_y, c.x - centre_x);
+        while (theta_end < theta_start) theta_end += 2 * _FASTOSUPARSER_PI;
+
+        // Go around the side "b" is on
+        double direction = 1;
+        double theta_range = theta_end - theta_start;
+        if ((c.y - a.y) * (b.x - a.x) - (c.x - a.x) * (b.y - a.y) < 0) {
+                direction = -1;
+                theta_range = 2 * _FASTOSUPARSER_PI - theta_range;
+        }
+
+        // Enough points to stay within 0.1 px of the arc
+        int points_count = (2 * radius <= 0.1f) ? 2 : (int)ceil(theta_range / (2 * acos(1 - 0.1f / radius)));
+        if (points_count < 2) points_count = 2;
+
+        for (int i = 0; i < points_count; i++) {
+                double theta = theta_start + direction * ((double)i / (points_count - 1)) * theta_range;
+                _FastOsuParser__PathAdd(builder, centre_x + (float)cos(theta) * radius, centre_y + (float)sin(theta) * radius);
+        }
+
+        return 1;
+
+}
+
+// Flattens one slider onto the builder's arrays & cuts/extends it to "length" (like osu!)
+FASTOSUPARSER_DEF void _FastOsuParser__PathBuild(_FastOsuParser__PathBuilder* builder, int x, int y, char curve_type, const FastOsuParser__CurvePoint* curve_points, size_t curve_points_count, double length) {
+
+        size_t count = curve_points_count + 1;
+        if (!_FastOsuParser__Reserve((void**)&builder->control_points, &builder->control_points_capacity, count, sizeof(FastOsuParser__PathPoint))) {
+                builder->b_failed = 1;
+                return;
+        }
+        FastOsuParser__PathPoint* control_points = builder->control_points;
+        control_points[0].x = x;
+        control_points[0].y = y;
+        for (size_t i = 0; i < curve_points_count; i++) {
+                control_points[i+1].x = curve_points[i].x;
+                control_points[i+1].y = curve_points[i].y;
+        }
+
+        builder->path_begin = builder->points_count;
+
+        switch (curve_type) {
+                case 'L':
+                        for (size_t i = 0; i < count; i++) _FastOsuParser__PathAdd(builder, control_points[i].x, control_points[i].y);
+                break;
+
+                case 'C':
+                        _FastOsuParser__PathCatmull(builder, control_points, count);
+                break;
+
+                case 'P':
+                        if (count == 3) {
+                                float side = (control_points[1].y - control_points[0].y) * (control_points[2].x - control_points[0].x) - (control_points[1].x - control_points[0].x) * (control_points[2].y - control_points[0].y);
+                                if (side > -1e-3f && side < 1e-3f) { // (on a line)
+                                        for (size_t i = 0; i < count; i++) _FastOsuParser__PathAdd(builder, control_points[i].x, control_points[i].y);
+                                        break;
+                                }
+                                if (_FastOsuParser__PathCircle(builder, control_points)) break;
+                        }
+                        _FastOsuParser__PathBezierSegments(builder, control_points, count);
+                break;
+
+                default:
+                        _FastOsuParser__PathBezierSegments(builder, control_points, count);
+        }
+
+        if (builder->b_failed) return;
+        if (!_FastOsuParser__Reserve((void**)&builder->lengths, &builder->lengths_capacity, builder->points_count, sizeof(float))) {
+                builder->b_failed = 1;
+                return;
+        }
+
+        FastOsuParser__PathPoint* points = builder->points + builder->path_begin;
+        float* lengths = builder->lengths + builder->path_begin;
+        size_t points_count = builder->points_count - builder->path_begin;
+
+        lengths[0] = 0;
+        for (size_t i = 1; i < points_count; i++) {
+                float dx = points[i].x - points[i-1].x;
+                float dy = points[i].y - points[i-1].y;
+                lengths[i] = lengths[i-1] + sqrtf(dx*dx + dy*dy);
+        }
+
+        // Cut/extend the end to the slider's length (not extended if the last 2 control points are the same, like osu!stable)
+        float expected_length = (float)length;
+        if (length <= 0 || points_count < 2 || lengths[points_count-1] == expected_length) return;
+        if (expected_length > lengths[points_count-1] && count >= 2 && control_points[count-1].x == control_points[count-2].x && control_points[count-1].y == control_points[count-2].y) return;
+
+        size_t end = points_count-1; // Last point, moved to "expected_length" along its segment
+        while (end > 0 && lengths[end-1] >= expected_length) end--;
+        if (end == 0) {
+                builder->points_count = builder->path_begin + 1;
+                return;
+        }
+
+        float dx = points[end].x - points[end-1].x;
+        float dy = points[end].y - points[end-1].y;
+        float segment_length = sqrtf(dx*dx + dy*dy);
+        float extra = expected_length - lengths[end-1];
+        points[end].x = points[end-1].x + dx / segment_length * extra;
+        points[end].y = points[end-1].y + dy / segment_length * extra;
+        lengths[end] = expected_length;
+
+        builder->points_count = builder->path_begin + end + 1;
+
+}
+
+// Flattens every slider of "beatmap" into "beatmap->slider_paths" (in one block, freed by FastOsuParser__Free())
+// Needs its curve points (FastOsuParser__PARSE_CURVE_POINTS), sliders without any are just their head
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ComputeSliderPaths(FastOsuParser__Beatmap* beatmap) {
+
+        free(beatmap->_paths);
+        beatmap->_paths = NULL;
+        beatmap->slider_paths = NULL;
+        beatmap->slider_paths_count = 0;
+
+        size_t sliders_count = 0;
+        if (beatmap->hit_objects != NULL) {
+                for (size_t ho = 0; ho < beatmap->hit_objects_count; ho++) sliders_count += (beatmap->hit_objects[ho].type & 0b00000010) != 0;
+        }
+        else sliders_count = beatmap->sliders_count;
+        if (sliders_count == 0) return FastOsuParser__SUCCESS;
+
+        FastOsuParser__SliderPath* paths = (FastOsuParser__SliderPath*)malloc(sizeof(FastOsuParser__SliderPath) * sliders_count); // (points & lengths are offsets until they're moved into the block)
+        if (paths == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+
+        _FastOsuParser__PathBuilder builder;
+        memset(&builder, 0, sizeof(builder));
+
+        size_t slider = 0;
+        for (size_t ho = 0; ho < beatmap->hit_objects_count && slider < sliders_count && !builder.b_failed; ho++) {
+
+                size_t begin = builder.points_count;
+
+                if (beatmap->hit_objects != NULL) {
+                        const FastOsuParser__HitObject* hit_object = &beatmap->hit_objects[ho];
+                        if (!(hit_object->type & 0b00000010)) continue;
+                        _FastOsuParser__PathBuild(&builder, hit_object->x, hit_object->y, hit_object->object_params.curve_type, hit_object->object_params.curve_points, (hit_object->object_params.curve_points == NULL) ? 0 : hit_object->object_params.curve_points_count, hit_object->object_params.length);
+                }
+                else {
+                        const FastOsuParser__Slider* columns_slider = &beatmap->sliders[slider];
+                        if (columns_slider->object != ho) continue;
+                        _FastOsuParser__PathBuild(&builder, beatmap->hit_objects_x[ho], beatmap->hit_objects_y[ho], columns_slider->curve_type, columns_slider->curve_points, (columns_slider->curve_points == NULL) ? 0 : columns_slider->curve_points_count, columns_slider->length);
+                }
+
+                paths[slider].object = ho;
+                paths[slider].points = (FastOsuParser__PathPoint*)(uintptr_t)begin;
+                paths[slider].points_count = builder.points_count - begin;
+                slider++;
+
+        }
+
+        // Move everything into one block: [paths][points][lengths]
+        size_t block_size =
+                sizeof(FastOsuParser__SliderPath) * sliders_count +
+                sizeof(FastOsuParser__PathPoint) * builder.points_count +
+                sizeof(float) * builder.points_count;
+        if (!builder.b_failed) beatmap->_paths = malloc(block_size);
+
+        if (beatmap->_paths != NULL) {
+                FastOsuParser__SliderPath* block_paths = (FastOsuParser__SliderPath*)beatmap->_paths;
+                FastOsuParser__PathPoint* block_points = (FastOsuParser__PathPoint*)(block_paths + sliders_count);
+                float* block_lengths = (float*)(block_points + builder.points_count);
+
+                memcpy(block_points, builder.points, sizeof(FastOsuParser__PathPoint) * builder.points_count);
+                memcpy(block_lengths, builder.lengths, sizeof(float) * builder.points_count);
+                for (size_t n = 0; n < sliders_count; n++) {
+                        size_t begin = (uintptr_t)paths[n].points;
+                        block_paths[n] = paths[n];
+                        block_paths[n].points = block_points + begin;
+                        block_paths[n].lengths = block_lengths + begin;
+                }
+
+                beatmap->slider_paths = block_paths;
+                beatmap->slider_paths_count = sliders_count;
+        }
+
+        free(paths);
+        free(builder.points);
+        free(builder.lengths);
+        free(builder.control_points);
+        free(builder.bezier);
+
+        return (beatmap->_paths == NULL) ? FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY : FastOsuParser__SUCCESS;
+
+}
+
+// First point at/after "distance" along the path (binary search, "lengths" only grows)
+FASTOSUPARSER_DEF size_t _FastOsuParser__PathIndex(const float* lengths, size_t count, float distance) {
+
+        size_t base = 0;
+        while (count > 1) {
+                size_t half = count / 2;
+                if (lengths[base+half] < distance) base += half;
+                count -= half;
+        }
+
+        return base + (lengths[base] < distance);
+
+}
+
+FASTOSUPARSER_DEF float _FastOsuParser__PathDistance(const FastOsuParser__SliderPath* path, float progress) {
+
+        if (!(progress > 0)) progress = 0; // (also NaN)
+        if (progress > 1) progress = 1;
+
+        return progress * path->lengths[path->points_count-1];
+
+}
+
+// Position at "progress" (0 = head, 1 = end of one slide) along a path from FastOsuParser__ComputeSliderPaths()
+FASTOSUPARSER_DEF FastOsuParser__PathPoint FastOsuParser__SliderPathAt(const FastOsuParser__SliderPath* path, float progress) {
+
+        float distance = _FastOsuParser__PathDistance(path, progress);
+        size_t i = _FastOsuParser__PathIndex(path->lengths, path->points_count, distance);
+
+        if (i == 0) return path->points[0];
+        if (i >= path->points_count) return path->points[path->points_count-1];
+
+        FastOsuParser__PathPoint p0 = path->points[i-1];
+        FastOsuParser__PathPoint p1 = path->points[i];
+        float d0 = path->lengths[i-1];
+        float d1 = path->lengths[i];
+        if (d1 - d0 < 1e-7f) return p0;
+
+        float w = (distance - d0) / (d1 - d0);
+        FastOsuParser__PathPoint point = { p0.x + (p1.x - p0.x) * w, p0.y + (p1.y - p0.y) * w };
+        return point;
+
+}
+
+// Where each slider ends (after all of its slides), "out[slider_paths_count]"
+// (paths are cut to their slider's length, so that's just their first or last point)
+FASTOSUPARSER_DEF void FastOsuParser__SliderEndPositions(const FastOsuParser__Beatmap* beatmap, FastOsuParser__PathPoint* out) {
+
+        for (size_t n = 0; n < beatmap->slider_paths_count; n++) {
+                const FastOsuParser__SliderPath* path = &beatmap->slider_paths[n];
+                int slides = (beatmap->hit_objects != NULL) ? beatmap->hit_objects[path->object].object_params.slides : beatmap->sliders[n].slides;
+                out[n] = path->points[(slides % 2 == 1) ? path->points_count-1 : 0]; // (odd: at the end, even: back at the head)
+        }
+
+}
+
+
+
+#if !defined(FASTOSUPARSER_COMPRESSED_BLOCK)
+#define FASTOSUPARSER_COMPRESSED_BLOCK 128 // Hit objects per block of a FastOsuParser__CompressedBeatmap
+#endif
+
+// Where a block of hit objects starts in a FastOsuParser__CompressedBeatmap (blocks decode independently of each other)
+typedef struct {
+        size_t offset; // Into "data"
+        size_t sliders; // Before this block
+        size_t spinners;
+        size_t curve_points;
+        int time; // Of its first hit object (the others are stored as deltas)
+} FastOsuParser__CompressedBlock;
+
+// Compact copy of a parsed beatmap, to keep a whole library in memory (FastOsuParser__Compress())
+// Hit objects are stored in blocks, where each column (time deltas, types, coordinates, slider & spinner params)
+// is frame-of-reference bit packed (its smallest value, then fixed-width offsets from it), so decoding one is a branchless loop,
+// and curve points are zigzag varint deltas from the previous point
+typedef struct {
+        FastOsuParser__Beatmap beatmap; // Everything but the arrays (like a cache file)
+        FastOsuParser__TimingPoint* timing_points; // As is
+        FastOsuParser__CompressedBlock* blocks;
+        size_t blocks_count;
+        unsigned char* data;
+        size_t sliders_count;
+        size_t spinners_count;
+        size_t curve_points_count;
+        size_t size; // Of all of the above but "beatmap", in one allocation
+        void* _memory;
+} FastOsuParser__CompressedBeatmap;
+
+// A block's columns, decoded
+typedef struct {
+        size_t count;
+        int time[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int type[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int x[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int y[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int b_params[FASTOSUPARSER_COMPRESSED_BLOCK]; // (sliders/spinners can lack theirs in columns)
+
+        size_t sliders_count;
+        int curve_type[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int slides[FASTOSUPARSER_COMPRESSED_BLOCK];
+        int curve_points_count[FASTOSUPARSER_COMPRESSED_BLOCK];
+        double length[FASTOSUPARSER_COMPRESSED_BLOCK];
+
+        size_t spinners_count;
+        int end_time[FASTOSUPARSER_COMPRESSED_BLOCK]; // (from the spinner's "time")
+} _FastOsuParser__CompressedColumns;
+
+FASTOSUPARSER_DEF uint32_t _FastOsuParser__ZigZag(int value) {
+        return ((uint32_t)value << 1) ^ (0U - ((uint32_t)value >> 31));
+}
+
+FASTOSUPARSER_DEF int _FastOsuParser__UnZigZag(uint32_t value) {
+        return (int)((value >> 1) ^ (0U - (value & 1)));
+}
+
+// (the compilers turn these into a single load)
+FASTOSUPARSER_DEF uint64_t _FastOsuParser__Load64Le(const unsigned char* p) {
+        return (uint64_t)p[0] | (uint64_t)p[1] << 8 | (uint64_t)p[2] << 16 | (uint64_t)p[3] << 24 | (uint64_t)p[4] << 32 | (uint64_t)p[5] << 40 | (uint64_t)p[6] << 48 | (uint64_t)p[7] << 56;
+}
+
+FASTOSUPARSER_DEF uint32_t _FastOsuParser__Load32Le(const unsigned char* p) {
+        return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Writes "values[count]" as their minimum (4 bytes), the bit width of the offsets from it (1 byte), then the offsets
+FASTOSUPARSER_DEF unsigned char* _FastOsuParser__PackColumn(unsigned char* p, const int* values, size_t count) {
+
+        int min = (count == 0) ? 0 : values[0];
+        for (size_t n = 1; n < count; n++) if (values[n] < min) min = values[n];
+
+        uint32_t max_offset = 0;
+        for (size_t n = 0; n < count; n++) if ((uint32_t)values[n] - (uint32_t)min > max_offset) max_offset = (uint32_t)values[n] - (uint32_t)min;
+        int width = 0;
+        while (width < 32 && (max_offset >> width) != 0) width++;
+
+        for (int n = 0; n < 4; n++) *p++ = (unsigned char)((uint32_t)min >> (8*n));
+        *p++ = (unsigned char)width;
+
+        uint64_t bits = 0;
+        int bits_count = 0;
+        for (size_t n = 0; n < count; n++) {
+                bits |= (uint64_t)((uint32_t)values[n] - (uint32_t)min) << bits_count;
+                bits_count += width;
+                for (; bits_count >= 8; bits_count -= 8, bits >>= 8) *p++ = (unsigned char)bits;
+        }
+        if (bits_count > 0) *p++ = (unsigned char)bits;
+
+        return p;
+
+}
+
+// Reads a column written by _FastOsuParser__PackColumn() (needs 8 readable bytes past it, see FastOsuParser__Compress())
+FASTOSUPARSER_DEF const unsigned char* _FastOsuParser__UnpackColumn(const unsigned char* p, int* values, size_t count) {
+
+        uint32_t min = _FastOsuParser__Load32Le(p);
+        int width = p[4];
+        p += 5;
+
+        uint64_t mask = (1ULL << width) - 1;
+        for (size_t n = 0, bit = 0; n < count; n++, bit += width) values[n] = (int)(min + (uint32_t)((_FastOsuParser__Load64Le(p + bit/8) >> (bit%8)) & mask));
+
+        return p + (count*width + 7) / 8;
+
+}
+
+FASTOSUPARSER_DEF unsigned char* _FastOsuParser__PutVarint(unsigned char* p, uint32_t value) {
+
+        for (; value >= 0x80; value >>= 7) *p++ = (unsigned char)(value | 0x80);
+        *p++ = (unsigned char)value;
+
+        return p;
+
+}
+
+FASTOSUPARSER_DEF uint32_t _FastOsuParser__GetVarint(const unsigned char** p) {
+
+        uint32_t value = 0;
+        int shift = 0;
+        const unsigned char* i = *p;
+        for (; *i & 0x80; i++, shift += 7) value |= (uint32_t)(*i & 0x7F) << shift;
+        value |= (uint32_t)*i << shift;
+        *p = i+1;
+
+        return value;
+
+}
+
+FASTOSUPARSER_DEF void FastOsuParser__CompressedFree(FastOsuParser__CompressedBeatmap* compressed) {
+
+        free(compressed->_memory);
+        memset(compressed, 0, sizeof(*compressed));
+
+}
+
+// Compresses "beatmap" (its "hit_objects" or columns) into "*out", free it with FastOsuParser__CompressedFree()
+// (timing index & slider paths aren't kept, FastOsuParser__Decompress() can recompute the index)
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__Compress(const FastOsuParser__Beatmap* beatmap, FastOsuParser__CompressedBeatmap* out) {
+
+        memset(out, 0, sizeof(*out));
+
+        size_t hit_objects_count = (beatmap->hit_objects != NULL || beatmap->hit_objects_type != NULL) ? beatmap->hit_objects_count : 0;
+        for (size_t ho = 0; ho < hit_objects_count; ho++) {
+                int b_params;
+                FastOsuParser__HitObject hit_object = _FastOsuParser__GetHitObject(beatmap, ho, &b_params);
+                if (!b_params) continue;
+                if (hit_object.type & 0b00000010) {
+                        out->sliders_count++;
+                        if (hit_object.object_params.curve_points != NULL) out->curve_points_count += hit_object.object_params.curve_points_count;
+                }
+                else out->spinners_count++;
+        }
+        out->blocks_count = (hit_objects_count + FASTOSUPARSER_COMPRESSED_BLOCK-1) / FASTOSUPARSER_COMPRESSED_BLOCK;
+
+        // Worst case: 32-bit offsets everywhere, 8-byte lengths, 5-byte varints, + 8 bytes for _FastOsuParser__UnpackColumn() to read past the end
+        size_t data_capacity =
+                out->blocks_count * (9*5 + 1) +
+                5*4 * hit_objects_count +
+                (3*4 + 8) * out->sliders_count +
+                4 * out->spinners_count +
+                2*5 * out->curve_points_count +
+                8;
+        size_t header_size = // (all 8-byte aligned or less)
+                sizeof(FastOsuParser__CompressedBlock) * out->blocks_count +
+                sizeof(FastOsuParser__TimingPoint) * beatmap->timing_points_count;
+        out->_memory = malloc(header_size + data_capacity);
+        if (out->_memory == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+
+        out->blocks = (FastOsuParser__CompressedBlock*)out->_memory;
+        out->timing_points = (FastOsuParser__TimingPoint*)(out->blocks + out->blocks_count);
+        out->data = (unsigned char*)(out->timing_points + beatmap->timing_points_count);
+        if (beatmap->timing_points_count != 0) memcpy(out->timing_points, beatmap->timing_points, sizeof(FastOsuParser__TimingPoint) * beatmap->timing_points_count);
+
+        unsigned char* p = out->data;
+        _FastOsuParser__CompressedColumns columns;
+        size_t sliders = 0;
+        size_t spinners = 0;
+        size_t curve_points = 0;
+        for (size_t block = 0; block < out->blocks_count; block++) {
+
+                size_t first = block * FASTOSUPARSER_COMPRESSED_BLOCK;
+                columns.count = (hit_objects_count - first < FASTOSUPARSER_COMPRESSED_BLOCK) ? hit_objects_count - first : FASTOSUPARSER_COMPRESSED_BLOCK;
+                columns.sliders_count = 0;
+                columns.spinners_count = 0;
+
+                FastOsuParser__CompressedBlock* compressed_block = &out->blocks[block];
+                compressed_block->offset = p - out->data;
+                compressed_block->sliders = sliders;
+                compressed_block->spinners = spinners;
+                compressed_block->curve_points = curve_points;
+
+                int previous_time = 0;
+                for (size_t n = 0; n < columns.count; n++) {
+                        FastOsuParser__HitObject hit_object = _FastOsuParser__GetHitObject(beatmap, first+n, &columns.b_params[n]);
+                        if (n == 0) compressed_block->time = previous_time = hit_object.time;
+                        columns.time[n] = (int)((uint32_t)hit_object.time - (uint32_t)previous_time);
+                        previous_time = hit_object.time;
+                        columns.type[n] = hit_object.type;
+                        columns.x[n] = hit_object.x;
+                        columns.y[n] = hit_object.y;
+                        if (!columns.b_params[n]) continue;
+
+                        if (hit_object.type & 0b00000010) {
+                                size_t s = columns.sliders_count++;
+                                columns.curve_type[s] = hit_object.object_params.curve_type;
+                                columns.slides[s] = hit_object.object_params.slides;
+                                columns.curve_points_count[s] = (hit_object.object_params.curve_points == NULL) ? 0 : (int)hit_object.object_params.curve_points_count;
+                                columns.length[s] = hit_object.object_params.length;
+                        }
+                        else columns.end_time[columns.spinners_count++] = (int)((uint32_t)hit_object.object_params.end_time - (uint32_t)hit_object.time);
+                }
+
+                p = _FastOsuParser__PackColumn(p, columns.time, columns.count);
+                p = _FastOsuParser__PackColumn(p, columns.type, columns.count);
+                p = _FastOsuParser__PackColumn(p, columns.x, columns.count);
+                p = _FastOsuParser__PackColumn(p, columns.y, columns.count);
+                p = _FastOsuParser__PackColumn(p, columns.b_params, columns.count);
+
+                p = _FastOsuParser__PackColumn(p, columns.curve_type, columns.sliders_count);
+                p = _FastOsuParser__PackColumn(p, columns.slides, columns.sliders_count);
+                p = _FastOsuParser__PackColumn(p, columns.curve_points_count, columns.sliders_count);
+
+                // Lengths as ints if they all are, else as floats if that's exact, else as is
+                int b_ints = 1;
+                int b_floats = 1;
+                for (size_t s = 0; s < columns.sliders_count; s++) {
+                        double length = columns.length[s];
+                        if (!(length > INT_MIN && length < INT_MAX && length == (double)(int)length)) b_ints = 0;
+                        if ((double)(float)length != length) b_floats = 0;
+                }
+                *p++ = b_ints ? 0 : b_floats ? 4 : 8;
+                if (b_ints) {
+                        int lengths[FASTOSUPARSER_COMPRESSED_BLOCK];
+                        for (size_t s = 0; s < columns.sliders_count; s++) lengths[s] = (int)columns.length[s];
+                        p = _FastOsuParser__PackColumn(p, lengths, columns.sliders_count);
+                }
+                else for (size_t s = 0; s < columns.sliders_count; s++) {
+                        if (b_floats) {
+                                float length = (float)columns.length[s];
+                                memcpy(p, &length, 4);
+                                p += 4;
+                        }
+                        else {
+                                memcpy(p, &columns.length[s], 8);
+                                p += 8;
+                        }
+                }
+
+                p = _FastOsuParser__PackColumn(p, columns.end_time, columns.spinners_count);
+
+                // Curve points, each from the previous one (from the slider's head for the first)
+                for (size_t n = 0; n < columns.count; n++) {
+                        if (!columns.b_params[n] || !(columns.type[n] & 0b00000010)) continue;
+                        int b_params;
+                        FastOsuParser__HitObject hit_object = _FastOsuParser__GetHitObject(beatmap, first+n, &b_params);
+                        if (hit_object.object_params.curve_points == NULL) continue;
+                        FastOsuParser__CurvePoint previous = { hit_object.x, hit_object.y };
+                        for (size_t cp = 0; cp < hit_object.object_params.curve_points_count; cp++) {
+                                FastOsuParser__CurvePoint curve_point = hit_object.object_params.curve_points[cp];
+                                p = _FastOsuParser__PutVarint(p, _FastOsuParser__ZigZag((int)((uint32_t)curve_point.x - (uint32_t)previous.x)));
+                                p = _FastOsuParser__PutVarint(p, _FastOsuParser__ZigZag((int)((uint32_t)curve_point.y - (uint32_t)previous.y)));
+                                previous = curve_point;
+                        }
+                        curve_points += hit_object.object_params.curve_points_count;
+                }
+
+                sliders += columns.sliders_count;
+                spinners += columns.spinners_count;
+
+        }
+        memset(p, 0, 8);
+        p += 8;
+
+        // Give back what the worst case didn't need
+        out->size = header_size + (p - out->data);
+        void* memory = realloc(out->_memory, out->size);
+        if (memory != NULL) {
+                out->_memory = memory;
+                out->blocks = (FastOsuParser__CompressedBlock*)memory;
+                out->timing_points = (FastOsuParser__TimingPoint*)(out->blocks + out->blocks_count);
+                out->data = (unsigned char*)(out->timing_points + beatmap->timing_points_count);
+        }
+
+        out->beatmap = *beatmap;
+        out->beatmap.timing_points = NULL;
+        out->beatmap.hit_objects = NULL;
+        out->beatmap.hit_objects_count = hit_objects_count;
+        out->beatmap.hit_objects_x = NULL;
+        out->beatmap.hit_objects_y = NULL;
+        out->beatmap.hit_objects_time = NULL;
+        out->beatmap.hit_objects_type = NULL;
+        out->beatmap.hit_objects_params = NULL;
+        out->beatmap.sliders = NULL;
+        out->beatmap.sliders_count = 0;
+        out->beatmap.spinners = NULL;
+        out->beatmap.spinners_count = 0;
+        out->beatmap.timing_index = NULL;
+        out->beatmap.hit_object_timings = NULL;
+        out->beatmap.slider_paths = NULL;
+        out->beatmap.slider_paths_count = 0;
+        out->beatmap._paths = NULL;
+        memset(&out->beatmap.allocator, 0, sizeof(out->beatmap.allocator));
+        out->beatmap._arena = NULL;
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+// Decodes the columns of block "block" of "compressed", and its sliders' curve points into "curve_points"
+FASTOSUPARSER_DEF void _FastOsuParser__DecodeColumns(const FastOsuParser__CompressedBeatmap* compressed, size_t block, _FastOsuParser__CompressedColumns* columns, FastOsuParser__CurvePoint* curve_points) {
+
+        const FastOsuParser__CompressedBlock* compressed_block = &compressed->blocks[block];
+        size_t first = block * FASTOSUPARSER_COMPRESSED_BLOCK;
+        columns->count = (compressed->beatmap.hit_objects_count - first < FASTOSUPARSER_COMPRESSED_BLOCK) ? compressed->beatmap.hit_objects_count - first : FASTOSUPARSER_COMPRESSED_BLOCK;
+        columns->sliders_count = ((block+1 < compressed->blocks_count) ? compressed_block[1].sliders : compressed->sliders_count) - compressed_block->sliders;
+        columns->spinners_count = ((block+1 < compressed->blocks_count) ? compressed_block[1].spinners : compressed->spinners_count) - compressed_block->spinners;
+
+        const unsigned char* p = compressed->data + compressed_block->offset;
+        p = _FastOsuParser__UnpackColumn(p, columns->time, columns->count);
+        p = _FastOsuParser__UnpackColumn(p, columns->type, columns->count);
+        p = _FastOsuParser__UnpackColumn(p, columns->x, columns->count);
+        p = _FastOsuParser__UnpackColumn(p, columns->y, columns->count);
+        p = _FastOsuParser__UnpackColumn(p, columns->b_params, columns->count);
+
+        uint32_t time = (uint32_t)compressed_block->time;
+        for (size_t n = 0; n < columns->count; n++) columns->time[n] = (int)(time += (uint32_t)columns->time[n]);
+
+        p = _FastOsuParser__UnpackColumn(p, columns->curve_type, columns->sliders_count);
+        p = _FastOsuParser__UnpackColumn(p, columns->slides, columns->sliders_count);
+        p = _FastOsuParser__UnpackColumn(p, columns->curve_points_count, columns->sliders_count);
+
+        int lengths_size = *p++;
+        if (lengths_size == 0) {
+                int lengths[FASTOSUPARSER_COMPRESSED_BLOCK];
+                p = _FastOsuParser__UnpackColumn(p, lengths, columns->sliders_count);
+                for (size_t s = 0; s < columns->sliders_count; s++) columns->length[s] = lengths[s];
+        }
+        else for (size_t s = 0; s < columns->sliders_count; s++) {
+                if (lengths_size == 4) {
+                        float length;
+                        memcpy(&length, p, 4);
+                        columns->length[s] = length;
+                }
+                else memcpy(&columns->length[s], p, 8);
+                p += lengths_size;
+        }
+
+        p = _FastOsuParser__UnpackColumn(p, columns->end_time, columns->spinners_count);
+
+        for (size_t n = 0, s = 0; n < columns->count; n++) {
+                if (!columns->b_params[n] || !(columns->type[n] & 0b00000010)) continue;
+                FastOsuParser__CurvePoint previous = { columns->x[n], columns->y[n] };
+                for (int cp = 0; cp < columns->curve_points_count[s]; cp++) {
+                        previous.x = (int)((uint32_t)previous.x + (uint32_t)_FastOsuParser__UnZigZag(_FastOsuParser__GetVarint(&p)));
+                        previous.y = (int)((uint32_t)previous.y + (uint32_t)_FastOsuParser__UnZigZag(_FastOsuParser__GetVarint(&p)));
+                        *curve_points++ = previous;
+                }
+                s++;
+        }
+
+}
+
+// Decodes block "block" of "compressed" into "hit_objects" (FASTOSUPARSER_COMPRESSED_BLOCK of them, fewer in the last block),
+// with its sliders' curve points going to "curve_points" (as many as the next block's "curve_points" minus this one's)
+// Returns the number of hit objects decoded
+FASTOSUPARSER_DEF size_t FastOsuParser__DecodeBlock(const FastOsuParser__CompressedBeatmap* compressed, size_t block, FastOsuParser__HitObject* hit_objects, FastOsuParser__CurvePoint* curve_points) {
+
+        _FastOsuParser__CompressedColumns columns;
+        _FastOsuParser__DecodeColumns(compressed, block, &columns, curve_points);
+
+        for (size_t n = 0, s = 0, sp = 0; n < columns.count; n++) {
+                FastOsuParser__HitObject* hit_object = &hit_objects[n];
+                memset(hit_object, 0, sizeof(*hit_object));
+                hit_object->x = columns.x[n];
+                hit_object->y = columns.y[n];
+                hit_object->time = columns.time[n];
+                hit_object->type = columns.type[n];
+                if (!columns.b_params[n]) continue;
+
+                if (hit_object->type & 0b00000010) {
+                        hit_object->object_params.curve_type = (char)columns.curve_type[s];
+                        hit_object->object_params.curve_points = (columns.curve_points_count[s] == 0) ? NULL : curve_points;
+                        hit_object->object_params.curve_points_count = columns.curve_points_count[s];
+                        hit_object->object_params.slides = columns.slides[s];
+                        hit_object->object_params.length = columns.length[s];
+                        curve_points += columns.curve_points_count[s];
+                        s++;
+                }
+                else hit_object->object_params.end_time = (int)((uint32_t)hit_object->time + (uint32_t)columns.end_time[sp++]);
+        }
+
+        return columns.count;
+
+}
+
+// Decompresses "compressed" into "*out" like parsing it would have (free it with FastOsuParser__Free())
+// Set "out->parse_flags"/"out->allocator" like for parsing to get columns (FastOsuParser__PARSE_COLUMNS) and/or the timing index
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__Decompress(const FastOsuParser__CompressedBeatmap* compressed, FastOsuParser__Beatmap* out) {
+
+        int flags = out->parse_flags;
+        FastOsuParser__Allocator allocator = out->allocator;
+        *out = compressed->beatmap;
+        out->parse_flags = flags;
+        out->allocator = allocator;
+
+        size_t arena_size = // (same layout as parsing)
+                sizeof(FastOsuParser__TimingPoint) * out->timing_points_count +
+                sizeof(FastOsuParser__CurvePoint) * compressed->curve_points_count;
+
+        size_t column_size = 0;
+        if (flags & FastOsuParser__PARSE_COLUMNS) {
+                column_size = (sizeof(int) * out->hit_objects_count + 63) & ~(size_t)63;
+                arena_size +=
+                        63 + 5 * column_size +
+                        sizeof(FastOsuParser__Slider) * compressed->sliders_count +
+                        sizeof(FastOsuParser__Spinner) * compressed->spinners_count;
+        }
+        else arena_size += sizeof(FastOsuParser__HitObject) * out->hit_objects_count;
+
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                arena_size +=
+                        sizeof(FastOsuParser__Timing) * out->timing_points_count +
+                        sizeof(FastOsuParser__HitObjectTiming) * out->hit_objects_count;
+        }
+
+        if (arena_size != 0) {
+                if (out->allocator.alloc != NULL) out->_arena = out->allocator.alloc(arena_size, out->allocator.user);
+                else out->_arena = malloc(arena_size);
+                if (out->_arena == NULL) return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+
+        char* arena = (char*)out->_arena;
+        if (flags & FastOsuParser__PARSE_COLUMNS) {
+                arena += (64 - (uintptr_t)arena % 64) % 64;
+                out->hit_objects_x = (int*)arena;
+                out->hit_objects_y = (int*)(arena + column_size);
+                out->hit_objects_time = (int*)(arena + 2*column_size);
+                out->hit_objects_type = (int*)(arena + 3*column_size);
+                out->hit_objects_params = (int*)(arena + 4*column_size);
+                out->sliders = (FastOsuParser__Slider*)(arena + 5*column_size);
+                out->sliders_count = compressed->sliders_count;
+                out->spinners = (FastOsuParser__Spinner*)(out->sliders + compressed->sliders_count);
+                out->spinners_count = compressed->spinners_count;
+                arena = (char*)(out->spinners + compressed->spinners_count);
+        }
+        out->timing_points = (FastOsuParser__TimingPoint*)arena;
+        arena = (char*)(out->timing_points + out->timing_points_count);
+        if (!(flags & FastOsuParser__PARSE_COLUMNS)) {
+                out->hit_objects = (FastOsuParser__HitObject*)arena;
+                arena = (char*)(out->hit_objects + out->hit_objects_count);
+        }
+        FastOsuParser__CurvePoint* curve_points = (FastOsuParser__CurvePoint*)arena;
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) {
+                out->timing_index = (FastOsuParser__Timing*)(curve_points + compressed->curve_points_count);
+                out->hit_object_timings = (FastOsuParser__HitObjectTiming*)(out->timing_index + out->timing_points_count);
+        }
+
+        if (out->timing_points_count != 0) memcpy(out->timing_points, compressed->timing_points, sizeof(FastOsuParser__TimingPoint) * out->timing_points_count);
+
+        for (size_t block = 0; block < compressed->blocks_count; block++) {
+                const FastOsuParser__CompressedBlock* compressed_block = &compressed->blocks[block];
+                size_t first = block * FASTOSUPARSER_COMPRESSED_BLOCK;
+
+                if (!(flags & FastOsuParser__PARSE_COLUMNS)) {
+                        FastOsuParser__DecodeBlock(compressed, block, out->hit_objects + first, curve_points + compressed_block->curve_points);
+                        continue;
+                }
+
+                _FastOsuParser__CompressedColumns columns;
+                _FastOsuParser__DecodeColumns(compressed, block, &columns, curve_points + compressed_block->curve_points);
+                memcpy(out->hit_objects_x + first, columns.x, sizeof(int) * columns.count);
+                memcpy(out->hit_objects_y + first, columns.y, sizeof(int) * columns.count);
+                memcpy(out->hit_objects_time + first, columns.time, sizeof(int) * columns.count);
+                memcpy(out->hit_objects_type + first, columns.type, sizeof(int) * columns.count);
+
+                FastOsuParser__CurvePoint* curve_point = curve_points + compressed_block->curve_points;
+                size_t s = 0;
+                size_t sp = 0;
+                for (size_t n = 0; n < columns.count; n++) {
+                        if (!columns.b_params[n]) out->hit_objects_params[first+n] = -1;
+                        else if (columns.type[n] & 0b00000010) {
+                                FastOsuParser__Slider* slider = &out->sliders[compressed_block->sliders + s];
+                                out->hit_objects_params[first+n] = (int)(compressed_block->sliders + s);
+                                slider->object = first+n;
+                                slider->curve_type = (char)columns.curve_type[s];
+                                slider->curve_points = (columns.curve_points_count[s] == 0) ? NULL : curve_point;
+                                slider->curve_points_count = columns.curve_points_count[s];
+                                slider->slides = columns.slides[s];
+                                slider->length = columns.length[s];
+                                curve_point += columns.curve_points_count[s];
+                                s++;
+                        }
+                        else {
+                                FastOsuParser__Spinner* spinner = &out->spinners[compressed_block->spinners + sp];
+                                out->hit_objects_params[first+n] = (int)(compressed_block->spinners + sp);
+                                spinner->object = first+n;
+                                spinner->end_time = (int)((uint32_t)columns.time[n] + (uint32_t)columns.end_time[sp]);
+                                sp++;
+                        }
+                }
+        }
+
+        if (flags & FastOsuParser__PARSE_TIMING_INDEX) _FastOsuParser__IndexTiming(out);
+
+        return FastOsuParser__SUCCESS;
+
+}
+
+
+
+#if defined(FASTOSUPARSER_PROFILE)
+
+#define FASTOSUPARSER_PROFILE_BUCKETS 64
+
+// Histograms of a batch's files' FastOsuParser__Profile (FastOsuParser__BatchOptions.profile)
+// Bucket "n" counts the files that took [2^n, 2^(n+1)) ns (0 ns goes to bucket 0), see FastOsuParser__ProfilePercentile()
+typedef struct {
+        size_t files; // Parsed or failed (not duplicates)
+        FastOsuParser__Profile total; // Summed over them
+        uint64_t parse_ns[FASTOSUPARSER_PROFILE_BUCKETS];
+        uint64_t io_ns[FASTOSUPARSER_PROFILE_BUCKETS];
+        uint64_t section_ns[FastOsuParser__PROFILE_SECTIONS][FASTOSUPARSER_PROFILE_BUCKETS];
+        size_t slowest; // Index of the path with the longest "parse_ns"
+} FastOsuParser__BatchProfile;
+
+FASTOSUPARSER_DEF size_t _FastOsuParser__ProfileBucket(uint64_t ns) {
+
+        size_t bucket = 0;
+        while (ns >>= 1) bucket++;
+
+        return bucket;
+
+}
+
+// Upper bound (ns) of the "percentile" (0-100) of "histogram", f.ex. 99 for the p99
+FASTOSUPARSER_DEF uint64_t FastOsuParser__ProfilePercentile(const uint64_t histogram[FASTOSUPARSER_PROFILE_BUCKETS], double percentile) {
+
+        uint64_t count = 0;
+        for (size_t bucket = 0; bucket < FASTOSUPARSER_PROFILE_BUCKETS; bucket++) count += histogram[bucket];
+        if (count == 0) return 0;
+
+        uint64_t rank = (uint64_t)ceil(count * percentile / 100);
+        if (rank == 0) rank = 1;
+        uint64_t seen = 0;
+        for (size_t bucket = 0; bucket < FASTOSUPARSER_PROFILE_BUCKETS; bucket++) {
+                seen += histogram[bucket];
+                if (seen >= rank) return (bucket == FASTOSUPARSER_PROFILE_BUCKETS-1) ? UINT64_MAX : (2ULL << bucket) - 1;
+        }
+
+        return UINT64_MAX;
+
+}
+
+#endif
+
+typedef struct {
+        size_t threads; // 0 = one per CPU core
+        char b_io_uring; // (Linux 5.6+) Open/stat/read files asynchronously, overlapping I/O with parsing (falls back to pread() if unavailable)
+        size_t io_queue_depth; // Files in flight per thread with "b_io_uring", 0 = 32
+        char b_skip_duplicates; // Only parse the first path of files with the same contents ("hash"), the later ones get FastOsuParser__ERROR_DUPLICATE_FILE
+#if defined(FASTOSUPARSER_PROFILE)
+        FastOsuParser__BatchProfile* profile; // (optional) Filled from the files' "profile" (I/O isn't timed with "b_io_uring", it overlaps with parsing)
+#endif
+} FastOsuParser__BatchOptions;
+
+typedef struct _FastOsuParser__BatchWorker _FastOsuParser__BatchWorker;
+
+typedef struct {
+        uint64_t hash;
+        size_t path_index; // +1, 0 = empty slot
+} _FastOsuParser__BatchFile;
+
+typedef struct {
+        const char** paths;
+        FastOsuParser__Beatmap* outs;
+        FastOsuParser__Error* errs;
+        _FastOsuParser__BatchWorker* workers;
+        size_t workers_count;
+        const FastOsuParser__BatchOptions* options;
+
+        _FastOsuParser__BatchFile* files; // Contents seen so far (FastOsuParser__BatchOptions.b_skip_duplicates, else NULL)
+        size_t files_mask; // (open addressing, power of 2 - 1)
+        char* b_duplicates; // Paths with the same contents as an earlier path: skipped when hashed, or parsed before that path came up & undone at the end
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__Mutex files_mutex;
+#endif
+} _FastOsuParser__Batch;
+
+struct _FastOsuParser__BatchWorker {
+        _FastOsuParser__Batch* batch;
+        size_t id;
+
+        // Not yet parsed paths of this worker (taken from the front by its owner, stolen from the back by others)
+        size_t begin;
+        size_t end;
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__Mutex mutex;
+        _FastOsuParser__Thread thread;
+        char b_thread_started;
+#endif
+
+        // Reused between files
+        char* buffer;
+        size_t buffer_capacity;
+};
+
+// Takes the next path of "worker", or steals half of the remaining paths of the busiest other worker
+// Returns 0 when there are no paths left anywhere
+FASTOSUPARSER_DEF int _FastOsuParser__BatchNext(_FastOsuParser__BatchWorker* worker, size_t* path_index) {
+
+#if defined(FASTOSUPARSER_NO_THREADS)
+
+        if (worker->begin == worker->end) return 0;
+        *path_index = worker->begin++;
+        return 1;
+
+#else
+
+        _FastOsuParser__MutexLock(&worker->mutex);
+        if (worker->begin < worker->end) {
+                *path_index = worker->begin++;
+                _FastOsuParser__MutexUnlock(&worker->mutex);
+                return 1;
+        }
+        _FastOsuParser__MutexUnlock(&worker->mutex);
+
+        _FastOsuParser__Batch* batch = worker->batch;
+        for (;;) {
+
+                _FastOsuParser__BatchWorker* victim = NULL;
+                size_t victim_remaining = 0;
+                for (size_t w = 1; w < batch->workers_count; w++) {
+                        _FastOsuParser__BatchWorker* other = &batch->workers[(worker->id + w) % batch->workers_count];
+
+                        _FastOsuParser__MutexLock(&other->mutex);
+                        size_t remaining = other->end - other->begin;
+                        _FastOsuParser__MutexUnlock(&other->mutex);
+
+                        if (remaining > victim_remaining) {
+                                victim = other;
+                                victim_remaining = remaining;
+                        }
+                }
+                if (victim == NULL) return 0;
+
+                _FastOsuParser__MutexLock(&victim->mutex);
+                size_t remaining = victim->end - victim->begin;
+                if (remaining == 0) { // Emptied in the meantime by its owner/another thief
+                        _FastOsuParser__MutexUnlock(&victim->mutex);
+                        continue;
+                }
+                size_t stolen_begin = victim->end - (remaining+1)/2;
+                size_t stolen_end = victim->end;
+                victim->end = stolen_begin;
+                _FastOsuParser__MutexUnlock(&victim->mutex);
+
+                _FastOsuParser__MutexLock(&worker->mutex);
+                worker->begin = stolen_begin+1;
+                worker->end = stolen_end;
+                _FastOsuParser__MutexUnlock(&worker->mutex);
+
+                *path_index = stolen_begin;
+                return 1;
+
+        }
+
+#endif
+
+}
+
+// Records that "path_index" has contents "hash", returns 0 if an earlier path has them too
+// (so the lowest path index always wins, whatever order the threads get to them in)
+FASTOSUPARSER_DEF int _FastOsuParser__BatchClaim(_FastOsuParser__Batch* batch, uint64_t hash, size_t path_index) {
+
+        int b_first = 1;
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexLock(&batch->files_mutex);
+#endif
+
+        size_t slot = hash & batch->files_mask;
+        while (batch->files[slot].path_index != 0 && batch->files[slot].hash != hash) slot = (slot+1) & batch->files_mask;
+
+        if (batch->files[slot].path_index == 0) {
+                batch->files[slot].hash = hash;
+                batch->files[slot].path_index = path_index+1;
+        }
+        else if (batch->files[slot].path_index-1 < path_index) {
+                batch->b_duplicates[path_index] = 1;
+                b_first = 0;
+        }
+        else { // A later path got here first
+                batch->b_duplicates[batch->files[slot].path_index-1] = 1;
+                batch->files[slot].path_index = path_index+1;
+        }
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        _FastOsuParser__MutexUnlock(&batch->files_mutex);
+#endif
+
+        return b_first;
+
+}
+
+// Parses a read (& padded) file of the batch (hashing it first to skip duplicates before any parsing work)
+FASTOSUPARSER_DEF FastOsuParser__Error _FastOsuParser__BatchParse(_FastOsuParser__Batch* batch, size_t path_index, const char* data, size_t len) {
+
+        FastOsuParser__Beatmap* out = &batch->outs[path_index];
+        int flags = (out->parse_flags == 0) ? FastOsuParser__PARSE_ALL : out->parse_flags;
+        if (batch->workers_count > 1) flags |= FastOsuParser__PARSE_SINGLE_THREAD; // (the files are already spread over the threads, splitting them too would run threads² of them)
+
+        if (batch->files != NULL) {
+                _FastOsuParser__HashBuffer(data, len, flags | FastOsuParser__PARSE_HASH, out);
+                if (!_FastOsuParser__BatchClaim(batch, out->hash, path_index)) return FastOsuParser__ERROR_DUPLICATE_FILE;
+        }
+        else if (flags & (FastOsuParser__PARSE_MD5 | FastOsuParser__PARSE_HASH)) _FastOsuParser__HashBuffer(data, len, flags, out);
+
+        return _FastOsuParser__ParseBufferFlags(data, len, flags, NULL, NULL, NULL, NULL, out);
+
+}
+
+#if defined(_FASTOSUPARSER_IO_URING)
+
+// Minimal io_uring (no liburing dependency)
+typedef struct {
+        int fd;
+        unsigned entries;
+
+        void* sq_ring;
+        size_t sq_ring_size;
+        unsigned* sq_head;
+        unsigned* sq_tail;
+        unsigned* sq_mask;
+        unsigned* sq_array;
+        struct io_uring_sqe* sqes;
+        unsigned sqes_to_submit;
+        unsigned in_flight; // Submitted, not completed yet
+
+        void* cq_ring;
+        size_t cq_ring_size;
+        unsigned* cq_head;
+        unsigned* cq_tail;
+        unsigned* cq_mask;
+        struct io_uring_cqe* cqes;
+} _FastOsuParser__Ring;
+
+// Returns 0 if io_uring (with openat/statx/read/close) is unavailable
+FASTOSUPARSER_DEF int _FastOsuParser__RingInit(_FastOsuParser__Ring* ring, unsigned entries) {
+
+        memset(ring, 0, sizeof(*ring));
+
+        struct io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        ring->fd = syscall(__NR_io_uring_setup, entries, &params);
+        if (ring->fd < 0) return 0;
+        if (!(params.features & IORING_FEAT_RW_CUR_POS)) { // (pre-5.6 kernel, no IORING_OP_OPENAT/STATX/READ/CLOSE)
+                close(ring->fd);
+                return 0;
+        }
+        ring->entries = params.sq_entries;
+
+        ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+                if (ring->cq_ring_size > ring->sq_ring_size) ring->sq_ring_size = ring->cq_ring_size;
+                ring->cq_ring_size = 0;
+        }
+
+        ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+        if (ring->sq_ring == MAP_FAILED) {
+                close(ring->fd);
+                return 0;
+        }
+        ring->cq_ring = ring->sq_ring;
+        if (ring->cq_ring_size != 0) {
+                ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+                if (ring->cq_ring == MAP_FAILED) {
+                        munmap(ring->sq_ring, ring->sq_ring_size);
+                        close(ring->fd);
+                        return 0;
+                }
+        }
+        ring->sqes = (struct io_uring_sqe*)mmap(NULL, params.sq_entries * sizeof(struct io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+        if (ring->sqes == MAP_FAILED) {
+                if (ring->cq_ring_size != 0) munmap(ring->cq_ring, ring->cq_ring_size);
+                munmap(ring->sq_ring, ring->sq_ring_size);
+                close(ring->fd);
+                return 0;
+        }
+
+        ring->sq_head = (unsigned*)((char*)ring->sq_ring + params.sq_off.head);
+        ring->sq_tail = (unsigned*)((char*)ring->sq_ring + params.sq_off.tail);
+        ring->sq_mask = (unsigned*)((char*)ring->sq_ring + params.sq_off.ring_mask);
+        ring->sq_array = (unsigned*)((char*)ring->sq_ring + params.sq_off.array);
+        ring->cq_head = (unsigned*)((char*)ring->cq_ring + params.cq_off.head);
+        ring->cq_tail = (unsigned*)((char*)ring->cq_ring + params.cq_off.tail);
+        ring->cq_mask = (unsigned*)((char*)ring->cq_ring + params.cq_off.ring_mask);
+        ring->cqes = (struct io_uring_cqe*)((char*)ring->cq_ring + params.cq_off.cqes);
+
+        return 1;
+
+}
+
+FASTOSUPARSER_DEF void _FastOsuParser__RingFree(_FastOsuParser__Ring* ring) {
+
+        munmap(ring->sqes, ring->entries * sizeof(struct io_uring_sqe));
+        if (ring->cq_ring_size != 0) munmap(ring->cq_ring, ring->cq_ring_size);
+        munmap(ring->sq_ring, ring->sq_ring_size);
+        close(ring->fd);
+
+}
+
+// Submits queued SQEs, waiting for at least "wait" completions
+FASTOSUPARSER_DEF int _FastOsuParser__RingEnter(_FastOsuParser__Ring* ring, unsigned wait) {
+
+        for (;;) {
+                long result = syscall(__NR_io_uring_enter, ring->fd, ring->sqes_to_submit, wait, wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+                if (result >= 0) {
+                        ring->sqes_to_submit -= result;
+                        ring->in_flight += result;
+                        return 1;
+                }
+                if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return 0;
+        }
+
+}
+
+// Returns a zeroed SQE (the SQ is sized so that it can't overflow)
+FASTOSUPARSER_DEF struct io_uring_sqe* _FastOsuParser__RingSqe(_FastOsuParser__Ring* ring, unsigned char opcode, int fd, unsigned long long user_data) {
+
+        unsigned tail = *ring->sq_tail;
+        unsigned index = tail & *ring->sq_mask;
+
+        struct io_uring_sqe* sqe = &ring->sqes[index];
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = opcode;
+        sqe->fd = fd;
+        sqe->user_data = user_data;
+
+        ring->sq_array[index] = index;
+        __atomic_store_n(ring->sq_tail, tail+1, __ATOMIC_RELEASE);
+        ring->sqes_to_submit++;
+
+        return sqe;
+
+}
+
+// A file on its way through openat+statx -> read(s) -> parse
+typedef struct {
+        size_t path_index;
+        int pending; // Operations in flight
+        int fd;
+        struct statx stat;
+        size_t size;
+        size_t bytes_read;
+        FastOsuParser__Error error;
+        char* buffer;
+        size_t buffer_capacity;
+} _FastOsuParser__RingSlot;
+
+enum {
+        _FastOsuParser__RING_OPEN,
+        _FastOsuParser__RING_STAT,
+        _FastOsuParser__RING_READ,
+        _FastOsuParser__RING_CLOSE
+};
+
+FASTOSUPARSER_DEF void _FastOsuParser__RingRead(_FastOsuParser__Ring* ring, _FastOsuParser__RingSlot* slot, size_t slot_index) {
+
+        struct io_uring_sqe* sqe = _FastOsuParser__RingSqe(ring, IORING_OP_READ, slot->fd, slot_index << 2 | _FastOsuParser__RING_READ);
+        sqe->addr = (unsigned long long)(uintptr_t)(slot->buffer + slot->bytes_read);
+        sqe->len = slot->size - slot->bytes_read;
+        sqe->off = slot->bytes_read;
+        slot->pending++;
+
+}
+
+// After the ring broke: waits for what the kernel already took (closing the files it opens), then closes the slots' open files & the ones only queued to be closed
+// Afterwards no operation touches the slots or their buffers anymore, unless it returns 0 (if it can't even wait)
+FASTOSUPARSER_DEF int _FastOsuParser__RingAbandon(_FastOsuParser__Ring* ring, _FastOsuParser__RingSlot* slots, size_t slots_count) {
+
+        // Never submitted => never will be, but the closes have to happen anyway
+        unsigned tail = *ring->sq_tail;
+        for (unsigned n = tail - ring->sqes_to_submit; n != tail; n++) {
+                struct io_uring_sqe* sqe = &ring->sqes[n & *ring->sq_mask];
+                if (sqe->opcode == IORING_OP_CLOSE) close(sqe->fd);
+        }
+        ring->sqes_to_submit = 0;
+
+        int b_drained = 1;
+        while (ring->in_flight != 0) {
+                if (syscall(__NR_io_uring_enter, ring->fd, 0, 1, IORING_ENTER_GETEVENTS, NULL, 0) < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                        b_drained = 0;
+                        break;
+                }
+
+                unsigned head = *ring->cq_head;
+                unsigned cq_tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+                for (; head != cq_tail; head++) {
+                        struct io_uring_cqe* cqe = &ring->cqes[head & *ring->cq_mask];
+                        if ((cqe->user_data & 3) == _FastOsuParser__RING_OPEN && cqe->res >= 0) slots[cqe->user_data >> 2].fd = cqe->res;
+                        ring->in_flight--;
+                }
+                __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+        }
+
+        // (slots still pending haven't queued their close yet)
+        for (size_t s = 0; s < slots_count; s++) {
+                if (slots[s].pending == 0 || slots[s].fd < 0) continue;
+                close(slots[s].fd);
+                slots[s].fd = -1;
+        }
+
+        return b_drained;
+
+}
+
+// Keeps up to "io_queue_depth" files of "worker" in flight, parsing each one as soon as it's read
+// Leaves paths to the synchronous loop if io_uring is (or becomes) unavailable
+FASTOSUPARSER_DEF void _FastOsuParser__BatchWorkIoUring(_FastOsuParser__BatchWorker* worker) {
+
+        _FastOsuParser__Batch* batch = worker->batch;
+
+        size_t slots_count = (batch->options->io_queue_depth != 0) ? batch->options->io_queue_depth : 32;
+        _FastOsuParser__RingSlot* slots = (_FastOsuParser__RingSlot*)calloc(slots_count, sizeof(_FastOsuParser__RingSlot));
+        if (slots == NULL) return;
+
+        _FastOsuParser__Ring ring; // (3 unsubmitted SQEs per slot at most: its last file's close if submitting it failed, then openat+statx)
+        if (!_FastOsuParser__RingInit(&ring, slots_count*3)) {
+                free(slots);
+                return;
+        }
+
+        size_t active_slots = 0;
+        size_t closes_in_flight = 0;
+        char b_more_paths = 1;
+        char b_leak = 0;
+        for (;;) {
+
+                // Start new files
+                for (size_t s = 0; s < slots_count && b_more_paths; s++) {
+                        if (slots[s].pending != 0) continue;
+                        if (!_FastOsuParser__BatchNext(worker, &slots[s].path_index)) {
+                                b_more_paths = 0;
+                                break;
+                        }
+
+                        const char* path = batch->paths[slots[s].path_index];
+                        slots[s].fd = -1;
+                        slots[s].bytes_read = 0;
+                        slots[s].error = FastOsuParser__SUCCESS;
+                        slots[s].pending = 2;
+                        active_slots++;
+
+                        struct io_uring_sqe* sqe = _FastOsuParser__RingSqe(&ring, IORING_OP_OPENAT, AT_FDCWD, s << 2 | _FastOsuParser__RING_OPEN);
+                        sqe->addr = (unsigned long long)(uintptr_t)path;
+                        sqe->open_flags = O_RDONLY | O_CLOEXEC;
+
+                        sqe = _FastOsuParser__RingSqe(&ring, IORING_OP_STATX, AT_FDCWD, s << 2 | _FastOsuParser__RING_STAT);
+                        sqe->addr = (unsigned long long)(uintptr_t)path;
+                        sqe->len = STATX_SIZE;
+                        sqe->off = (unsigned long long)(uintptr_t)&slots[s].stat;
+                }
+
+                if (active_slots == 0 && closes_in_flight == 0 && ring.sqes_to_submit == 0) break;
+
+                if (!_FastOsuParser__RingEnter(&ring, active_slots != 0 || closes_in_flight != 0)) { // Ring broke: redo in-flight files synchronously
+                        if (!_FastOsuParser__RingAbandon(&ring, slots, slots_count)) b_leak = 1;
+
+                        for (size_t s = 0; s < slots_count; s++) {
+                                if (slots[s].pending == 0) continue;
+
+                                size_t beatmap_file_size;
+                                FastOsuParser__Error error = _FastOsuParser__ReadFile(batch->paths[slots[s].path_index], &worker->buffer, &worker->buffer_capacity, &beatmap_file_size);
+                                if (error == FastOsuParser__SUCCESS) error = _FastOsuParser__BatchParse(batch, slots[s].path_index, worker->buffer, beatmap_file_size);
+                                if (batch->errs != NULL) batch->errs[slots[s].path_index] = error;
+                        }
+                        break;
+                }
+
+                // Handle completions
+                unsigned head = *ring.cq_head;
+                unsigned tail = __atomic_load_n(ring.cq_tail, __ATOMIC_ACQUIRE);
+                for (; head != tail; head++) {
+
+                        struct io_uring_cqe* cqe = &ring.cqes[head & *ring.cq_mask];
+                        int operation = cqe->user_data & 3;
+                        _FastOsuParser__RingSlot* slot = &slots[cqe->user_data >> 2];
+                        ring.in_flight--;
+                        if (operation == _FastOsuParser__RING_CLOSE) {
+                                closes_in_flight--;
+                                continue;
+                        }
+
+                        if (operation == _FastOsuParser__RING_OPEN) {
+                                if (cqe->res < 0) slot->error = FastOsuParser__ERROR_FAILED_TO_OPEN_FILE;
+                                else slot->fd = cqe->res;
+                        }
+                        else if (operation == _FastOsuParser__RING_STAT) {
+                                if (cqe->res < 0) { if (slot->error == FastOsuParser__SUCCESS) slot->error = FastOsuParser__ERROR_FAILED_TO_TELL_FILE; }
+                                else slot->size = slot->stat.stx_size;
+                        }
+                        else if (cqe->res <= 0) slot->error = FastOsuParser__ERROR_FAILED_TO_READ_FILE;
+                        else slot->bytes_read += cqe->res;
+
+                        if (--slot->pending != 0) continue;
+
+                        // Opened & sized => read
+                        if (operation != _FastOsuParser__RING_READ && slot->error == FastOsuParser__SUCCESS && slot->size != 0) {
+                                if (!_FastOsuParser__ReserveBuffer(&slot->buffer, &slot->buffer_capacity, slot->size)) slot->error = FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                                else {
+                                        _FastOsuParser__RingRead(&ring, slot, cqe->user_data >> 2);
+                                        continue;
+                                }
+                        }
+
+                        // Short read => read the rest
+                        if (slot->error == FastOsuParser__SUCCESS && slot->bytes_read < slot->size) {
+                                _FastOsuParser__RingRead(&ring, slot, cqe->user_data >> 2);
+                                continue;
+                        }
+
+                        // Done with the file => parse it while the others are in flight
+                        if (slot->fd >= 0) {
+                                _FastOsuParser__RingSqe(&ring, IORING_OP_CLOSE, slot->fd, _FastOsuParser__RING_CLOSE);
+                                closes_in_flight++;
+                        }
+                        __atomic_store_n(ring.cq_head, head+1, __ATOMIC_RELEASE);
+                        if (ring.sqes_to_submit != 0) _FastOsuParser__RingEnter(&ring, 0);
+
+                        FastOsuParser__Error error = slot->error;
+                        if (error == FastOsuParser__SUCCESS && slot->buffer != NULL) FastOsuParser__Pad(slot->buffer + slot->size); // (empty files have no buffer, nothing is read then)
+                        if (error == FastOsuParser__SUCCESS) error = _FastOsuParser__BatchParse(batch, slot->path_index, slot->buffer, slot->size);
+                        if (batch->errs != NULL) batch->errs[slot->path_index] = error;
+                        active_slots--;
+
+                }
+                __atomic_store_n(ring.cq_head, head, __ATOMIC_RELEASE);
+
+        }
+
+        _FastOsuParser__RingFree(&ring);
+        if (b_leak) return; // (the kernel might still write to the slots & their buffers until it's done tearing the ring down)
+        for (size_t s = 0; s < slots_count; s++) free(slots[s].buffer);
+        free(slots);
+
+}
+
+#endif
+
+FASTOSUPARSER_DEF void _FastOsuParser__BatchWork(_FastOsuParser__BatchWorker* worker) {
+
+        _FastOsuParser__Batch* batch = worker->batch;
+
+#if defined(_FASTOSUPARSER_IO_URING)
+        if (batch->options != NULL && batch->options->b_io_uring) _FastOsuParser__BatchWorkIoUring(worker);
+#endif
+
+        size_t path_index;
+        while (_FastOsuParser__BatchNext(worker, &path_index)) {
+
+#if defined(FASTOSUPARSER_PROFILE)
+                uint64_t profile_start = _FastOsuParser__Now();
+#endif
+                size_t beatmap_file_size;
+                FastOsuParser__Error error = _FastOsuParser__ReadFile(batch->paths[path_index], &worker->buffer, &worker->buffer_capacity, &beatmap_file_size);
+#if defined(FASTOSUPARSER_PROFILE)
+                batch->outs[path_index].profile.io_ns += _FastOsuParser__Now() - profile_start;
+#endif
+                if (error == FastOsuParser__SUCCESS) error = _FastOsuParser__BatchParse(batch, path_index, worker->buffer, beatmap_file_size);
+
+                if (batch->errs != NULL) batch->errs[path_index] = error;
+
+        }
+
+}
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+#if defined(_WIN32)
+FASTOSUPARSER_DEF DWORD WINAPI _FastOsuParser__BatchThread(LPVOID worker) {
+        _FastOsuParser__BatchWork((_FastOsuParser__BatchWorker*)worker);
+        return 0;
+}
+#else
+FASTOSUPARSER_DEF void* _FastOsuParser__BatchThread(void* worker) {
+        _FastOsuParser__BatchWork((_FastOsuParser__BatchWorker*)worker);
+        return NULL;
+}
+#endif
+#endif
+
+// Parses "paths[n]" into "outs[n]" (make sure they're 0-initialized, or only have "parse_flags"/"allocator"/"string_pool" set)
+// on multiple threads, with each file's result in "errs[n]" ("errs" can be NULL)
+// Results don't depend on the number of threads; "allocator" callbacks must be thread-safe
+// "options" can be NULL
+FASTOSUPARSER_DEF FastOsuParser__Error FastOsuParser__ParseBatch(
+        const char** paths,
+        size_t n,
+        FastOsuParser__Beatmap* outs,
+        FastOsuParser__Error* errs,
+        const FastOsuParser__BatchOptions* options
+) {
+
+        _FastOsuParser__Batch batch;
+        batch.paths = paths;
+        batch.outs = outs;
+        batch.errs = errs;
+        batch.options = options;
+        batch.files = NULL;
+        batch.b_duplicates = NULL;
+
+        if (options != NULL && options->b_skip_duplicates) {
+                size_t files_capacity = 16;
+                while (files_capacity < 2*n) files_capacity *= 2;
+                batch.files_mask = files_capacity-1;
+                batch.files = (_FastOsuParser__BatchFile*)calloc(files_capacity, sizeof(*batch.files));
+                batch.b_duplicates = (char*)calloc(n+1, 1);
+                if (batch.files == NULL || batch.b_duplicates == NULL) {
+                        free(batch.files);
+                        free(batch.b_duplicates);
+                        return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+                }
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                _FastOsuParser__MutexInit(&batch.files_mutex);
+#endif
+        }
+
+#if defined(FASTOSUPARSER_NO_THREADS)
+        batch.workers_count = 1;
+#else
+        batch.workers_count = (options != NULL && options->threads != 0) ? options->threads : _FastOsuParser__CpuCount();
+        if (batch.workers_count > n) batch.workers_count = n;
+#endif
+        if (batch.workers_count == 0) batch.workers_count = 1;
+
+        batch.workers = (_FastOsuParser__BatchWorker*)calloc(batch.workers_count, sizeof(_FastOsuParser__BatchWorker));
+        if (batch.workers == NULL) {
+                if (batch.files != NULL) {
+                        free(batch.files);
+                        free(batch.b_duplicates);
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                        _FastOsuParser__MutexDestroy(&batch.files_mutex);
+#endif
+                }
+                return FastOsuParser__ERROR_FAILED_TO_ALLOCATE_MEMORY;
+        }
+
+        // Split the paths evenly, stealing evens out the rest
+        for (size_t w = 0; w < batch.workers_count; w++) {
+                batch.workers[w].batch = &batch;
+                batch.workers[w].id = w;
+                batch.workers[w].begin = n * w / batch.workers_count;
+                batch.workers[w].end = n * (w+1) / batch.workers_count;
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                _FastOsuParser__MutexInit(&batch.workers[w].mutex);
+#endif
+        }
+
+        // This thread is worker 0 (if a thread fails to start, its paths get stolen by the others)
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        for (size_t w = 1; w < batch.workers_count; w++) {
+#if defined(_WIN32)
+                batch.workers[w].thread = CreateThread(NULL, 0, _FastOsuParser__BatchThread, &batch.workers[w], 0, NULL);
+                batch.workers[w].b_thread_started = (batch.workers[w].thread != NULL);
+#else
+                batch.workers[w].b_thread_started = (pthread_create(&batch.workers[w].thread, NULL, _FastOsuParser__BatchThread, &batch.workers[w]) == 0);
+#endif
+        }
+#endif
+
+        _FastOsuParser__BatchWork(&batch.workers[0]);
+
+#if !defined(FASTOSUPARSER_NO_THREADS)
+        for (size_t w = 1; w < batch.workers_count; w++) {
+                if (!batch.workers[w].b_thread_started) continue;
+#if defined(_WIN32)
+                WaitForSingleObject(batch.workers[w].thread, INFINITE);
+                CloseHandle(batch.workers[w].thread);
+#else
+                pthread_join(batch.workers[w].thread, NULL);
+#endif
+        }
+#endif
+
+        for (size_t w = 0; w < batch.workers_count; w++) {
+                free(batch.workers[w].buffer);
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                _FastOsuParser__MutexDestroy(&batch.workers[w].mutex);
+#endif
+        }
+        free(batch.workers);
+
+#if defined(FASTOSUPARSER_PROFILE)
+        if (options != NULL && options->profile != NULL) {
+                FastOsuParser__BatchProfile* profile = options->profile;
+                memset(profile, 0, sizeof(*profile));
+
+                for (size_t path_index = 0; path_index < n; path_index++) {
+                        if (batch.b_duplicates != NULL && batch.b_duplicates[path_index]) continue;
+
+                        const FastOsuParser__Profile* file = &outs[path_index].profile;
+                        profile->files++;
+                        profile->parse_ns[_FastOsuParser__ProfileBucket(file->parse_ns)]++;
+                        profile->io_ns[_FastOsuParser__ProfileBucket(file->io_ns)]++;
+                        for (int section = 0; section < FastOsuParser__PROFILE_SECTIONS; section++) {
+                                profile->section_ns[section][_FastOsuParser__ProfileBucket(file->section_ns[section])]++;
+                                profile->total.section_ns[section] += file->section_ns[section];
+                                profile->total.section_bytes[section] += file->section_bytes[section];
+                        }
+                        profile->total.io_ns += file->io_ns;
+                        profile->total.hash_ns += file->hash_ns;
+                        profile->total.count_ns += file->count_ns;
+                        profile->total.finish_ns += file->finish_ns;
+                        profile->total.parse_ns += file->parse_ns;
+                        profile->total.allocations += file->allocations;
+                        profile->total.allocated_bytes += file->allocated_bytes;
+                        profile->total.curve_points += file->curve_points;
+                        if (file->parse_ns > outs[profile->slowest].profile.parse_ns) profile->slowest = path_index;
+                }
+        }
+#endif
+
+        // Undo the paths that lost to an earlier path with the same contents (nothing to free for the ones skipped right away)
+        if (batch.files != NULL) {
+                for (size_t path_index = 0; path_index < n; path_index++) {
+                        if (!batch.b_duplicates[path_index]) continue;
+
+                        FastOsuParser__Beatmap* out = &outs[path_index];
+                        FastOsuParser__Beatmap parsed = *out;
+                        FastOsuParser__Free(out);
+                        memset(out, 0, sizeof(*out));
+                        out->parse_flags = parsed.parse_flags;
+                        out->allocator = parsed.allocator;
+#if defined(FASTOSUPARSER_STRING_POOL)
+                        out->string_pool = parsed.string_pool;
+#endif
+                        memcpy(out->md5, parsed.md5, sizeof(out->md5));
+                        out->hash = parsed.hash;
+                        if (errs != NULL) errs[path_index] = FastOsuParser__ERROR_DUPLICATE_FILE;
+                }
+
+                free(batch.files);
+                free(batch.b_duplicates);
+#if !defined(FASTOSUPARSER_NO_THREADS)
+                _FastOsuParser__MutexDestroy(&batch.files_mutex);
+#endif
+        }
+
+        return FastOsuParser__SUCCESS;
 
 }
 
@@ -0,0 +1,286 @@
+/*
+Copyright (c) 2025 Amar Alic
+
+This software is provided 'as-is', without any express or implied
+warranty. In no event will the authors be held liable for any damages
+arising from the use of this software.
+
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it
+freely, subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+// C++20 front end: owning beatmaps, spans & string views over the same parser as FastOsuParser.h (nothing is copied)
+
+#ifndef _FAST_OSU_PARSER_HPP
+#define _FAST_OSU_PARSER_HPP
+
+#include "FastOsuParser.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <version>
+
+#if defined(__cpp_lib_expected)
+#include <expected>
+#endif
+
+namespace FastOsuParser {
+
+
+
+using Error = FastOsuParser__Error;
+
+#if defined(__cpp_lib_expected)
+
+template <typename T>
+using Expected = std::expected<T, Error>;
+using Unexpected = std::unexpected<Error>;
+
+#else
+
+// Error of a failed call (like std::unexpected)
+struct Unexpected {
+        explicit constexpr Unexpected(Error error) noexcept : error_(error) {}
+        constexpr Error error() const noexcept { return error_; }
+private:
+        Error error_;
+};
+
+// Thrown by Expected::value() on an error (like std::bad_expected_access)
+class BadExpectedAccess : public std::exception {
+public:
+        explicit BadExpectedAccess(Error error) noexcept : error_(error) {}
+        Error error() const noexcept { return error_; }
+        const char* what() const noexcept override { return "FastOsuParser: bad expected access"; }
+private:
+        Error error_;
+};
+
+[[noreturn]] inline void _ThrowBadExpectedAccess(Error error) {
+#if defined(__cpp_exceptions)
+        throw BadExpectedAccess(error);
+#else
+        (void)error;
+        std::abort();
+#endif
+}
+
+// A value or the error that prevented it (like C++23's std::expected<T, Error>, which it is where available)
+template <typename T>
+class Expected {
+public:
+        Expected(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) : value_(std::move(value)) {}
+        Expected(Unexpected unexpected) noexcept : error_(unexpected.error()) {}
+
+        bool has_value() const noexcept { return value_.has_value(); }
+        explicit operator bool() const noexcept { return has_value(); }
+        Error error() const noexcept { return error_; }
+
+        T& value() & { if (!has_value()) _ThrowBadExpectedAccess(error_); return *value_; }
+        const T& value() const& { if (!has_value()) _ThrowBadExpectedAccess(error_); return *value_; }
+        T&& value() && { if (!has_value()) _ThrowBadExpectedAccess(error_); return std::move(*value_); }
+
+        // (unchecked)
+        T& operator*() & noexcept { return *value_; }
+        const T& operator*() const& noexcept { return *value_; }
+        T&& operator*() && noexcept { return std::move(*value_); }
+        T* operator->() noexcept { return &*value_; }
+        const T* operator->() const noexcept { return &*value_; }
+
+private:
+        std::optional<T> value_;
+        Error error_ = FastOsuParser__SUCCESS;
+};
+
+template <>
+class Expected<void> {
+public:
+        Expected() noexcept = default;
+        Expected(Unexpected unexpected) noexcept : error_(unexpected.error()) {}
+
+        bool has_value() const noexcept { return error_ == FastOsuParser__SUCCESS; }
+        explicit operator bool() const noexcept { return has_value(); }
+        Error error() const noexcept { return error_; }
+        void value() const { if (!has_value()) _ThrowBadExpectedAccess(error_); }
+
+private:
+        Error error_ = FastOsuParser__SUCCESS;
+};
+
+#endif
+
+
+
+// What to parse & where into, set before parsing (like the matching FastOsuParser__Beatmap fields)
+struct Options {
+        int parse_flags = 0; // FastOsuParser__PARSE_*, 0 = everything
+        FastOsuParser__Allocator allocator = {}; // (optional) Allocate the beatmap's arena through your own callbacks instead of malloc()/free()
+#if defined(FASTOSUPARSER_STRING_POOL)
+        FastOsuParser__StringPool* string_pool = nullptr; // Pool the strings go into (nullptr = don't keep them), has to outlive the beatmap's string views
+#endif
+};
+
+// A parsed beatmap, owning its arena (& slider paths): freed when destroyed, moved but never copied
+// Arrays are spans into the arena (valid until it's destroyed, moves keep them), strings are views into the struct (until it's moved or destroyed) or its string pool
+class Beatmap {
+public:
+        Beatmap() noexcept { std::memset(&beatmap_, 0, sizeof(beatmap_)); }
+
+        explicit Beatmap(const Options& options) noexcept : Beatmap() {
+                beatmap_.parse_flags = options.parse_flags;
+                beatmap_.allocator = options.allocator;
+#if defined(FASTOSUPARSER_STRING_POOL)
+                beatmap_.string_pool = options.string_pool;
+#endif
+        }
+
+        Beatmap(const Beatmap&) = delete;
+        Beatmap& operator=(const Beatmap&) = delete;
+
+        Beatmap(Beatmap&& other) noexcept : beatmap_(other.beatmap_) { std::memset(&other.beatmap_, 0, sizeof(other.beatmap_)); }
+
+        Beatmap& operator=(Beatmap&& other) noexcept {
+                if (this != &other) {
+                        FastOsuParser__Free(&beatmap_);
+                        beatmap_ = other.beatmap_;
+                        std::memset(&other.beatmap_, 0, sizeof(other.beatmap_));
+                }
+                return *this;
+        }
+
+        ~Beatmap() { FastOsuParser__Free(&beatmap_); }
+
+        // The C struct, for everything without an accessor below (f.ex. "mode", "hp_drain_rate", "stats", "md5")
+        const FastOsuParser__Beatmap& c() const noexcept { return beatmap_; }
+        FastOsuParser__Beatmap& c() noexcept { return beatmap_; }
+        const FastOsuParser__Beatmap* operator->() const noexcept { return &beatmap_; }
+
+        // [General] & [Metadata]
+#if defined(FASTOSUPARSER_STRING_POOL)
+        std::string_view audio_file_name() const noexcept { return _String(beatmap_.audio_file_name); }
+        std::string_view title() const noexcept { return _String(beatmap_.title); }
+        std::string_view title_unicode() const noexcept { return _String(beatmap_.title_unicode); }
+        std::string_view artist() const noexcept { return _String(beatmap_.artist); }
+        std::string_view artist_unicode() const noexcept { return _String(beatmap_.artist_unicode); }
+        std::string_view creator() const noexcept { return _String(beatmap_.creator); }
+        std::string_view version() const noexcept { return _String(beatmap_.version); }
+        std::string_view source() const noexcept { return _String(beatmap_.source); }
+        std::string_view tags() const noexcept { return _String(beatmap_.tags); }
+#else
+        std::string_view audio_file_name() const noexcept { return std::string_view(beatmap_.audio_file_name, beatmap_.audio_file_name_size); }
+        std::string_view title() const noexcept { return std::string_view(beatmap_.title, beatmap_.title_size); }
+        std::string_view artist() const noexcept { return std::string_view(beatmap_.artist, beatmap_.artist_size); }
+        std::string_view creator() const noexcept { return std::string_view(beatmap_.creator, beatmap_.creator_size); }
+        std::string_view version() const noexcept { return std::string_view(beatmap_.version, beatmap_.version_size); }
+#endif
+
+        // [TimingPoints] & [HitObjects]
+        std::span<const FastOsuParser__TimingPoint> timing_points() const noexcept { return _Span(beatmap_.timing_points, beatmap_.timing_points_count); }
+        std::span<const FastOsuParser__HitObject> hit_objects() const noexcept { return _Span(beatmap_.hit_objects, beatmap_.hit_objects_count); }
+
+        // Of a slider of hit_objects() (empty for circles & spinners, or without FastOsuParser__PARSE_CURVE_POINTS)
+        static std::span<const FastOsuParser__CurvePoint> curve_points(const FastOsuParser__HitObject& hit_object) noexcept {
+                if (!(hit_object.type & 0b00000010)) return {};
+                return _Span(hit_object.object_params.curve_points, hit_object.object_params.curve_points_count);
+        }
+
+#if defined(FASTOSUPARSER_HIT_SOUNDS)
+        // Of a slider of hit_objects() (see FastOsuParser__EdgeSounds())
+        static std::span<const FastOsuParser__EdgeSound> edge_sounds(const FastOsuParser__HitObject& hit_object) noexcept {
+                if (!(hit_object.type & 0b00000010) || hit_object.object_params.edge_sounds_count == 0) return {};
+                return std::span<const FastOsuParser__EdgeSound>(FastOsuParser__EdgeSounds(hit_object.object_params.curve_points, &hit_object), hit_object.object_params.edge_sounds_count);
+        }
+#endif
+
+        // [HitObjects] as columns (FastOsuParser__PARSE_COLUMNS, empty otherwise)
+        std::span<const int> hit_objects_x() const noexcept { return _Span(beatmap_.hit_objects_x, beatmap_.hit_objects_count); }
+        std::span<const int> hit_objects_y() const noexcept { return _Span(beatmap_.hit_objects_y, beatmap_.hit_objects_count); }
+        std::span<const int> hit_objects_time() const noexcept { return _Span(beatmap_.hit_objects_time, beatmap_.hit_objects_count); }
+        std::span<const int> hit_objects_type() const noexcept { return _Span(beatmap_.hit_objects_type, beatmap_.hit_objects_count); }
+        std::span<const int> hit_objects_params() const noexcept { return _Span(beatmap_.hit_objects_params, beatmap_.hit_objects_count); }
+        std::span<const FastOsuParser__Slider> sliders() const noexcept { return _Span(beatmap_.sliders, beatmap_.sliders_count); }
+        std::span<const FastOsuParser__Spinner> spinners() const noexcept { return _Span(beatmap_.spinners, beatmap_.spinners_count); }
+
+        static std::span<const FastOsuParser__CurvePoint> curve_points(const FastOsuParser__Slider& slider) noexcept { return _Span(slider.curve_points, slider.curve_points_count); }
+
+        // Timing index (FastOsuParser__PARSE_TIMING_INDEX, empty otherwise)
+        std::span<const FastOsuParser__Timing> timing_index() const noexcept { return _Span(beatmap_.timing_index, beatmap_.timing_points_count); }
+        std::span<const FastOsuParser__HitObjectTiming> hit_object_timings() const noexcept { return _Span(beatmap_.hit_object_timings, beatmap_.hit_objects_count); }
+        FastOsuParser__Timing TimingAt(double time) const noexcept { return FastOsuParser__TimingAt(&beatmap_, time); }
+
+        // Slider paths (after ComputeSliderPaths(), empty before)
+        Expected<void> ComputeSliderPaths() noexcept {
+                Error error = FastOsuParser__ComputeSliderPaths(&beatmap_);
+                if (error != FastOsuParser__SUCCESS) return Unexpected(error);
+                return {};
+        }
+        std::span<const FastOsuParser__SliderPath> slider_paths() const noexcept { return _Span(beatmap_.slider_paths, beatmap_.slider_paths_count); }
+
+private:
+        FastOsuParser__Beatmap beatmap_;
+
+        template <typename T>
+        static std::span<const T> _Span(const T* data, size_t count) noexcept {
+                return (data == nullptr) ? std::span<const T>() : std::span<const T>(data, count);
+        }
+
+#if defined(FASTOSUPARSER_STRING_POOL)
+        std::string_view _String(FastOsuParser__StringView view) const noexcept {
+                if (beatmap_.string_pool == nullptr || view.size == 0) return {};
+                return std::string_view(FastOsuParser__String(beatmap_.string_pool, view), view.size);
+        }
+#endif
+};
+
+
+
+// Parses the file at "path" (FastOsuParser__Parse())
+inline Expected<Beatmap> Parse(const char* path, const Options& options = {}) {
+        Beatmap beatmap(options);
+        Error error = FastOsuParser__Parse(const_cast<char*>(path), &beatmap.c()); // (only read)
+        if (error != FastOsuParser__SUCCESS) return Unexpected(error);
+        return beatmap;
+}
+
+// Parses "data", in place but for a padded copy of its last lines (FastOsuParser__ParseBuffer())
+inline Expected<Beatmap> ParseBuffer(std::string_view data, const Options& options = {}) {
+        Beatmap beatmap(options);
+        Error error = FastOsuParser__ParseBuffer(data.data(), data.size(), &beatmap.c());
+        if (error != FastOsuParser__SUCCESS) return Unexpected(error);
+        return beatmap;
+}
+
+// Parses "data" in place, which has to be followed by FASTOSUPARSER_PADDING writable bytes (FastOsuParser__ParseBufferPadded())
+inline Expected<Beatmap> ParseBufferPadded(char* data, size_t len, const Options& options = {}) {
+        Beatmap beatmap(options);
+        Error error = FastOsuParser__ParseBufferPadded(data, len, &beatmap.c());
+        if (error != FastOsuParser__SUCCESS) return Unexpected(error);
+        return beatmap;
+}
+
+// Parses the hit objects of "data" with t0 <= time <= t1 (ms), and its other sections as usual (FastOsuParser__ParseRange())
+inline Expected<Beatmap> ParseRange(std::string_view data, int t0, int t1, const Options& options = {}) {
+        Beatmap beatmap(options);
+        Error error = FastOsuParser__ParseRange(data.data(), data.size(), t0, t1, &beatmap.c());
+        if (error != FastOsuParser__SUCCESS) return Unexpected(error);
+        return beatmap;
+}
+
+} // namespace FastOsuParser
+
+#endif
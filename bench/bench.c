@@ -0,0 +1,742 @@
+// FastOsuParser benchmark: generates deterministic .osu files & times the parser's APIs on them
+// Build from the repository root: cc -O2 -I. bench/bench.c -o fastosuparser_bench -lm -pthread
+// Run with --help for the generator's settings
+
+#include "FastOsuParser.h"
+
+#include <stdarg.h>
+#include <time.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+
+
+// Generator settings (same settings & seed = same bytes)
+typedef struct {
+        size_t objects;
+        double slider_ratio; // Of the hit objects (the rest are circles, & 1 in 100 is a spinner)
+        int curve_points; // Per slider
+        int timing_points_every; // Objects per timing point (one at the start at least)
+        uint64_t seed;
+} BenchSettings;
+
+// splitmix64
+uint64_t bench_random(uint64_t* state) {
+
+        uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+        return z ^ (z >> 31);
+
+}
+
+int bench_random_range(uint64_t* state, int min, int max) {
+        return min + (int)(bench_random(state) % (uint64_t)(max - min + 1));
+}
+
+typedef struct {
+        char* data;
+        size_t size;
+        size_t capacity;
+} BenchBuffer;
+
+void bench_append(BenchBuffer* buffer, const char* format, ...) {
+
+        va_list arguments;
+        for (;;) {
+                va_start(arguments, format);
+                int written = vsnprintf(buffer->data + buffer->size, buffer->capacity - buffer->size, format, arguments);
+                va_end(arguments);
+
+                if (written >= 0 && (size_t)written < buffer->capacity - buffer->size) {
+                        buffer->size += written;
+                        return;
+                }
+
+                buffer->capacity = (buffer->capacity == 0) ? 1 << 16 : buffer->capacity * 2;
+                buffer->data = realloc(buffer->data, buffer->capacity);
+                if (buffer->data == NULL) {
+                        fprintf(stderr, "out of memory\n");
+                        exit(1);
+                }
+        }
+
+}
+
+// A .osu file (CRLF, like osu! writes them) with "settings"
+BenchBuffer bench_generate(const BenchSettings* settings, int variant) {
+
+        BenchBuffer buffer = { NULL, 0, 0 };
+        uint64_t state = settings->seed ^ ((uint64_t)variant * 0xD1B54A32D192ED03ULL);
+
+        bench_append(&buffer, "osu file format v14\r\n\r\n");
+        bench_append(&buffer, "[General]\r\nAudioFilename: audio.mp3\r\nAudioLeadIn: 0\r\nPreviewTime: 1000\r\nCountdown: 0\r\nSampleSet: Soft\r\nStackLeniency: 0.7\r\nMode: 0\r\nLetterboxInBreaks: 0\r\nWidescreenStoryboard: 1\r\n\r\n");
+        bench_append(&buffer, "[Editor]\r\nDistanceSpacing: 1.2\r\nBeatDivisor: 4\r\nGridSize: 32\r\nTimelineZoom: 2\r\n\r\n");
+        bench_append(&buffer, "[Metadata]\r\nTitle:Benchmark %d\r\nTitleUnicode:Benchmark %d\r\nArtist:Generator\r\nArtistUnicode:Generator\r\nCreator:bench\r\nVersion:Seed %llu\r\nSource:\r\nTags:benchmark synthetic\r\nBeatmapID:%d\r\nBeatmapSetID:1\r\n\r\n", variant, variant, (unsigned long long)settings->seed, variant + 1);
+        bench_append(&buffer, "[Difficulty]\r\nHPDrainRate:5\r\nCircleSize:4\r\nOverallDifficulty:8\r\nApproachRate:9\r\nSliderMultiplier:1.4\r\nSliderTickRate:1\r\n\r\n");
+        bench_append(&buffer, "[Events]\r\n//Background and Video events\r\n0,0,\"bg.jpg\",0,0\r\n//Break Periods\r\n\r\n");
+
+        // Timing points spread over the objects (150-250 ms apart)
+        int duration = 1000 + (int)settings->objects * 200;
+        size_t timing_points = (settings->timing_points_every <= 0) ? 1 : settings->objects / settings->timing_points_every + 1;
+        bench_append(&buffer, "[TimingPoints]\r\n");
+        for (size_t tp = 0; tp < timing_points; tp++) {
+                int time = 1000 + (int)((double)duration * tp / timing_points);
+                if (tp % 4 == 0) bench_append(&buffer, "%d,%.12g,4,2,0,60,1,0\r\n", time, 60000.0 / bench_random_range(&state, 120, 240));
+                else bench_append(&buffer, "%d,%d,4,2,0,60,0,0\r\n", time, -bench_random_range(&state, 50, 200));
+        }
+        bench_append(&buffer, "\r\n\r\n[Colours]\r\nCombo1 : 255,128,0\r\n\r\n");
+
+        bench_append(&buffer, "[HitObjects]\r\n");
+        int time = 1000;
+        static const char curve_types[] = "BCLP";
+        for (size_t ho = 0; ho < settings->objects; ho++) {
+                int x = bench_random_range(&state, 0, 512);
+                int y = bench_random_range(&state, 0, 384);
+                int new_combo = (ho % 8 == 0) ? 4 : 0;
+                time += bench_random_range(&state, 150, 250);
+
+                if (ho % 100 == 99) {
+                        int end_time = time + bench_random_range(&state, 1000, 3000);
+                        bench_append(&buffer, "256,192,%d,%d,0,%d,0:0:0:0:\r\n", time, 8 | new_combo, end_time);
+                        time = end_time;
+                }
+                else if ((double)(bench_random(&state) >> 11) / (1ULL << 53) < settings->slider_ratio) {
+                        bench_append(&buffer, "%d,%d,%d,%d,0,%c", x, y, time, 2 | new_combo, curve_types[bench_random(&state) % 4]);
+                        for (int cp = 0; cp < settings->curve_points; cp++) { // (near the previous point, like real sliders)
+                                x += bench_random_range(&state, -40, 40);
+                                y += bench_random_range(&state, -40, 40);
+                                bench_append(&buffer, "|%d:%d", x, y);
+                        }
+                        bench_append(&buffer, ",%d,%.12g,2|0,0:0|0:0,0:0:0:0:\r\n", bench_random_range(&state, 1, 3), 35.0 * bench_random_range(&state, 1, 8));
+                }
+                else bench_append(&buffer, "%d,%d,%d,%d,0,0:0:0:0:\r\n", x, y, time, 1 | new_combo);
+        }
+
+        // Room for the padding FastOsuParser__ParseBufferPadded() writes after the file
+        if (buffer.capacity - buffer.size < FASTOSUPARSER_PADDING) {
+                buffer.capacity = buffer.size + FASTOSUPARSER_PADDING;
+                buffer.data = realloc(buffer.data, buffer.capacity);
+                if (buffer.data == NULL) {
+                        fprintf(stderr, "out of memory\n");
+                        exit(1);
+                }
+        }
+
+        return buffer;
+
+}
+
+
+
+uint64_t bench_now() {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+// Hardware counters of this thread (Linux perf_event_open(), unavailable elsewhere/without permission)
+typedef struct {
+        int fds[3]; // cycles, instructions, cache misses (-1 = unavailable)
+        uint64_t values[3];
+} BenchCounters;
+
+void bench_counters_open(BenchCounters* counters) {
+
+        for (int c = 0; c < 3; c++) counters->fds[c] = -1;
+
+#if defined(__linux__)
+        static const uint64_t configs[3] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES };
+        for (int c = 0; c < 3; c++) {
+                struct perf_event_attr attributes;
+                memset(&attributes, 0, sizeof(attributes));
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.size = sizeof(attributes);
+                attributes.config = configs[c];
+                attributes.disabled = 1;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+                counters->fds[c] = (int)syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0);
+        }
+#endif
+
+}
+
+void bench_counters_start(BenchCounters* counters) {
+
+#if defined(__linux__)
+        for (int c = 0; c < 3; c++) {
+                if (counters->fds[c] == -1) continue;
+                ioctl(counters->fds[c], PERF_EVENT_IOC_RESET, 0);
+                ioctl(counters->fds[c], PERF_EVENT_IOC_ENABLE, 0);
+        }
+#else
+        (void)counters;
+#endif
+
+}
+
+void bench_counters_stop(BenchCounters* counters) {
+
+        for (int c = 0; c < 3; c++) {
+                counters->values[c] = 0;
+#if defined(__linux__)
+                if (counters->fds[c] == -1) continue;
+                ioctl(counters->fds[c], PERF_EVENT_IOC_DISABLE, 0);
+                if (read(counters->fds[c], &counters->values[c], sizeof(uint64_t)) != sizeof(uint64_t)) counters->values[c] = 0;
+#endif
+        }
+
+}
+
+void bench_counters_close(BenchCounters* counters) {
+
+#if defined(__linux__)
+        for (int c = 0; c < 3; c++) if (counters->fds[c] != -1) close(counters->fds[c]);
+#else
+        (void)counters;
+#endif
+
+}
+
+
+
+// Straightforward line-by-line parser to compare against: strtol()/strtod() on each field, one malloc per array
+typedef struct {
+        size_t timing_points_count;
+        size_t hit_objects_count;
+        int* hit_objects_time;
+        FastOsuParser__CurvePoint* curve_points;
+        size_t curve_points_count;
+} BenchReference;
+
+void bench_reference_parse(const char* data, size_t len, BenchReference* out) {
+
+        memset(out, 0, sizeof(*out));
+        size_t hit_objects_capacity = 0;
+        size_t curve_points_capacity = 0;
+
+        char* line = NULL;
+        size_t line_capacity = 0;
+        const char* section = "";
+        const char* end = data + len;
+        for (const char* i = data; i < end;) {
+                const char* newline = memchr(i, '\n', end - i);
+                size_t line_size = (newline == NULL) ? (size_t)(end - i) : (size_t)(newline - i);
+                if (line_size + 1 > line_capacity) {
+                        line_capacity = line_size + 1;
+                        line = realloc(line, line_capacity);
+                }
+                memcpy(line, i, line_size);
+                line[line_size] = '\0';
+                if (line_size != 0 && line[line_size-1] == '\r') line[--line_size] = '\0';
+                i = (newline == NULL) ? end : newline + 1;
+
+                if (line[0] == '[') section = (strcmp(line, "[TimingPoints]") == 0) ? "T" : (strcmp(line, "[HitObjects]") == 0) ? "H" : "";
+                else if (line_size == 0) continue;
+                else if (section[0] == 'T') {
+                        strtol(line, NULL, 10);
+                        strtod(strchr(line, ',') + 1, NULL);
+                        out->timing_points_count++;
+                }
+                else if (section[0] == 'H') {
+                        char* field = line;
+                        strtol(field, &field, 10);
+                        strtol(field + 1, &field, 10);
+                        int time = (int)strtol(field + 1, &field, 10);
+                        int type = (int)strtol(field + 1, &field, 10);
+                        strtol(field + 1, &field, 10);
+
+                        if (out->hit_objects_count == hit_objects_capacity) {
+                                hit_objects_capacity = (hit_objects_capacity == 0) ? 256 : hit_objects_capacity * 2;
+                                out->hit_objects_time = realloc(out->hit_objects_time, sizeof(int) * hit_objects_capacity);
+                        }
+                        out->hit_objects_time[out->hit_objects_count++] = time;
+
+                        if ((type & 2) && *field == ',') {
+                                field += 2; // Curve type
+                                while (*field == '|') {
+                                        FastOsuParser__CurvePoint curve_point;
+                                        curve_point.x = (int)strtol(field + 1, &field, 10);
+                                        curve_point.y = (int)strtol(field + 1, &field, 10);
+                                        if (out->curve_points_count == curve_points_capacity) {
+                                                curve_points_capacity = (curve_points_capacity == 0) ? 256 : curve_points_capacity * 2;
+                                                out->curve_points = realloc(out->curve_points, sizeof(FastOsuParser__CurvePoint) * curve_points_capacity);
+                                        }
+                                        out->curve_points[out->curve_points_count++] = curve_point;
+                                }
+                                strtol(field + 1, &field, 10); // Slides
+                                strtod(field + 1, &field); // Length
+                        }
+                        else if ((type & 8) && *field == ',') strtol(field + 1, &field, 10);
+                }
+        }
+
+        free(line);
+
+}
+
+void bench_reference_free(BenchReference* reference) {
+        free(reference->hit_objects_time);
+        free(reference->curve_points);
+}
+
+
+
+typedef enum {
+        BENCH_FULL,
+        BENCH_COLUMNS,
+        BENCH_METADATA,
+        BENCH_NO_CURVE_POINTS,
+        BENCH_STREAM, // Fed in BENCH_STREAM_CHUNK byte chunks
+        BENCH_RANGE, // A BENCH_RANGE_WINDOW ms window in the middle of the beatmap
+        BENCH_REFERENCE
+} BenchApi;
+
+#define BENCH_STREAM_CHUNK (64 * 1024)
+#define BENCH_RANGE_WINDOW 10000
+
+// Bytes of "buffer" a metadata-only parse reads: up to the section after [Difficulty] (where it stops)
+size_t bench_metadata_size(const BenchBuffer* buffer) {
+
+        const char* end = buffer->data + buffer->size;
+        const char* difficulty = strstr(buffer->data, "[Difficulty]");
+        if (difficulty == NULL) return buffer->size;
+        for (const char* i = difficulty + 1; i < end; i++) {
+                if (*i == '[' && i[-1] == '\n') return i - buffer->data;
+        }
+
+        return buffer->size;
+
+}
+
+// Rest of a result line: the hardware counters per "objects" (those that are available)
+void bench_print_counters(const BenchCounters* counters, const uint64_t values[3], size_t objects) {
+        if (counters->fds[0] != -1) printf(" %8.1f cyc/obj", (double)values[0] / objects);
+        if (counters->fds[1] != -1) printf(" %8.1f ins/obj", (double)values[1] / objects);
+        if (counters->fds[2] != -1) printf(" %10llu misses", (unsigned long long)values[2]);
+        printf("\n");
+}
+
+// Best of "reps" runs of "api" over "buffer", printed as one line (returns its time, ns)
+uint64_t bench_run(const char* name, BenchApi api, const BenchBuffer* buffer, size_t objects, int reps, BenchCounters* counters) {
+
+        uint64_t best_ns = UINT64_MAX;
+        uint64_t best_values[3] = { 0, 0, 0 };
+        int range_begin = 1000 + (int)(objects * 100); // (objects are 200 ms apart on average)
+        size_t range_objects = 0;
+        for (int rep = 0; rep < reps; rep++) {
+
+                FastOsuParser__Beatmap beatmap;
+                memset(&beatmap, 0, sizeof(beatmap));
+                if (api == BENCH_COLUMNS) beatmap.parse_flags = FastOsuParser__PARSE_ALL | FastOsuParser__PARSE_COLUMNS;
+                else if (api == BENCH_METADATA) beatmap.parse_flags = FastOsuParser__PARSE_GENERAL | FastOsuParser__PARSE_METADATA | FastOsuParser__PARSE_DIFFICULTY;
+                else if (api == BENCH_NO_CURVE_POINTS) beatmap.parse_flags = FastOsuParser__PARSE_SECTIONS;
+                BenchReference reference;
+                FastOsuParser__Stream stream;
+
+                bench_counters_start(counters);
+                uint64_t start = bench_now();
+                if (api == BENCH_REFERENCE) bench_reference_parse(buffer->data, buffer->size, &reference);
+                else if (api == BENCH_STREAM) {
+                        FastOsuParser__StreamInit(&stream, &beatmap);
+                        for (size_t offset = 0; offset < buffer->size; offset += BENCH_STREAM_CHUNK) {
+                                FastOsuParser__StreamFeed(&stream, buffer->data + offset, (buffer->size - offset < BENCH_STREAM_CHUNK) ? buffer->size - offset : BENCH_STREAM_CHUNK);
+                        }
+                        FastOsuParser__StreamFinish(&stream);
+                }
+                else if (api == BENCH_RANGE) FastOsuParser__ParseRange(buffer->data, buffer->size, range_begin, range_begin + BENCH_RANGE_WINDOW, &beatmap);
+                else FastOsuParser__ParseBufferPadded(buffer->data, buffer->size, &beatmap);
+                uint64_t elapsed = bench_now() - start;
+                bench_counters_stop(counters);
+
+                if (api == BENCH_RANGE) range_objects = beatmap.hit_objects_count;
+                if (api == BENCH_REFERENCE) bench_reference_free(&reference);
+                else FastOsuParser__Free(&beatmap);
+
+                if (elapsed < best_ns) {
+                        best_ns = elapsed;
+                        memcpy(best_values, counters->values, sizeof(best_values));
+                }
+
+        }
+
+        if (best_ns == 0) best_ns = 1;
+        if (api == BENCH_METADATA) { // (stops early, so per file & over the bytes it read)
+                size_t size = bench_metadata_size(buffer);
+                printf("%-18s %10.2f us/file %8.1f MB/s of the first %zu bytes", name, best_ns / 1e3, size / (best_ns / 1e9) / 1e6, size);
+                bench_print_counters(counters, best_values, 1);
+                return best_ns;
+        }
+        if (api == BENCH_RANGE) { // (only decodes the window, so per call & per object in it)
+                printf("%-18s %10.2f us/call %8zu objects in %d ms %8.2f ns/obj", name, best_ns / 1e3, range_objects, BENCH_RANGE_WINDOW, (range_objects == 0) ? 0 : (double)best_ns / range_objects);
+                bench_print_counters(counters, best_values, (range_objects == 0) ? 1 : range_objects);
+                return best_ns;
+        }
+        printf("%-18s %10.1f MB/s %10.2f Mobj/s %8.2f ns/obj", name, buffer->size / (best_ns / 1e9) / 1e6, objects / (best_ns / 1e9) / 1e6, (double)best_ns / objects);
+        bench_print_counters(counters, best_values, objects);
+
+        return best_ns;
+
+}
+
+// Best of "reps" FastOsuParser__ComputeSliderPaths() + FastOsuParser__SliderEndPositions() on "buffer"'s beatmap (parsed once, outside of the timing)
+uint64_t bench_paths(const char* name, const BenchBuffer* buffer, int reps, BenchCounters* counters) {
+
+        FastOsuParser__Beatmap beatmap;
+        memset(&beatmap, 0, sizeof(beatmap));
+        if (FastOsuParser__ParseBufferPadded(buffer->data, buffer->size, &beatmap) != FastOsuParser__SUCCESS) {
+                fprintf(stderr, "%s: can't parse the generated beatmap\n", name);
+                exit(1);
+        }
+
+        uint64_t best_ns = UINT64_MAX;
+        uint64_t best_values[3] = { 0, 0, 0 };
+        FastOsuParser__PathPoint* ends = NULL;
+        for (int rep = 0; rep < reps; rep++) {
+
+                bench_counters_start(counters);
+                uint64_t start = bench_now();
+                FastOsuParser__Error error = FastOsuParser__ComputeSliderPaths(&beatmap);
+                if (error == FastOsuParser__SUCCESS && ends == NULL) ends = malloc(sizeof(FastOsuParser__PathPoint) * (beatmap.slider_paths_count + 1));
+                if (error == FastOsuParser__SUCCESS) FastOsuParser__SliderEndPositions(&beatmap, ends);
+                uint64_t elapsed = bench_now() - start;
+                bench_counters_stop(counters);
+
+                if (error != FastOsuParser__SUCCESS) {
+                        fprintf(stderr, "%s: FastOsuParser__ComputeSliderPaths() failed (%d)\n", name, (int)error);
+                        exit(1);
+                }
+
+                if (elapsed < best_ns) {
+                        best_ns = elapsed;
+                        memcpy(best_values, counters->values, sizeof(best_values));
+                }
+
+        }
+        size_t sliders = beatmap.slider_paths_count;
+        size_t points = 0;
+        for (size_t n = 0; n < sliders; n++) points += beatmap.slider_paths[n].points_count;
+
+        free(ends);
+        FastOsuParser__Free(&beatmap);
+
+        if (best_ns == 0) best_ns = 1;
+        if (sliders == 0) sliders = 1;
+        printf("%-18s %10.2f Mslider/s %8.2f ns/slider %8.1f points/slider", name, sliders / (best_ns / 1e9) / 1e6, (double)best_ns / sliders, (double)points / sliders);
+        bench_print_counters(counters, best_values, sliders);
+
+        return best_ns;
+
+}
+
+// FastOsuParser__Compress() & FastOsuParser__Decompress() of "buffer"'s beatmap (parsed once, outside of the timing), best of "reps" each
+// Sizes are of the parsed arrays (hit objects, curve points & timing points): the compression ratio against them, decoding in GB/s of them
+void bench_compress(const char* compress_name, const char* decode_name, const BenchBuffer* buffer, int reps, BenchCounters* counters) {
+
+        FastOsuParser__Beatmap beatmap;
+        memset(&beatmap, 0, sizeof(beatmap));
+        if (FastOsuParser__ParseBufferPadded(buffer->data, buffer->size, &beatmap) != FastOsuParser__SUCCESS) {
+                fprintf(stderr, "%s: can't parse the generated beatmap\n", compress_name);
+                exit(1);
+        }
+
+        size_t parsed_size = sizeof(FastOsuParser__HitObject) * beatmap.hit_objects_count + sizeof(FastOsuParser__TimingPoint) * beatmap.timing_points_count;
+        for (size_t ho = 0; ho < beatmap.hit_objects_count; ho++) {
+                if (beatmap.hit_objects[ho].type & 2) parsed_size += sizeof(FastOsuParser__CurvePoint) * beatmap.hit_objects[ho].object_params.curve_points_count;
+        }
+        size_t objects = (beatmap.hit_objects_count == 0) ? 1 : beatmap.hit_objects_count;
+
+        FastOsuParser__CompressedBeatmap compressed;
+        uint64_t compress_ns = UINT64_MAX;
+        uint64_t decompress_ns = UINT64_MAX;
+        uint64_t compress_values[3] = { 0, 0, 0 };
+        uint64_t decompress_values[3] = { 0, 0, 0 };
+        for (int rep = 0; rep < reps; rep++) {
+
+                bench_counters_start(counters);
+                uint64_t start = bench_now();
+                FastOsuParser__Error error = FastOsuParser__Compress(&beatmap, &compressed);
+                uint64_t elapsed = bench_now() - start;
+                bench_counters_stop(counters);
+                if (error != FastOsuParser__SUCCESS) {
+                        fprintf(stderr, "%s: FastOsuParser__Compress() failed (%d)\n", compress_name, (int)error);
+                        exit(1);
+                }
+                if (elapsed < compress_ns) {
+                        compress_ns = elapsed;
+                        memcpy(compress_values, counters->values, sizeof(compress_values));
+                }
+
+                FastOsuParser__Beatmap decompressed;
+                memset(&decompressed, 0, sizeof(decompressed));
+                bench_counters_start(counters);
+                start = bench_now();
+                error = FastOsuParser__Decompress(&compressed, &decompressed);
+                elapsed = bench_now() - start;
+                bench_counters_stop(counters);
+                if (error != FastOsuParser__SUCCESS || decompressed.hit_objects_count != beatmap.hit_objects_count) {
+                        fprintf(stderr, "%s: FastOsuParser__Decompress() failed (%d)\n", decode_name, (int)error);
+                        exit(1);
+                }
+                if (elapsed < decompress_ns) {
+                        decompress_ns = elapsed;
+                        memcpy(decompress_values, counters->values, sizeof(decompress_values));
+                }
+
+                FastOsuParser__Free(&decompressed);
+                if (rep != reps-1) FastOsuParser__CompressedFree(&compressed);
+
+        }
+
+        if (compress_ns == 0) compress_ns = 1;
+        if (decompress_ns == 0) decompress_ns = 1;
+        printf("%-18s %10.1f MB/s %10.2f Mobj/s %8.2f ns/obj %8.2fx smaller (%zu of %zu bytes, %.2fx of the file)", compress_name, parsed_size / (compress_ns / 1e9) / 1e6, objects / (compress_ns / 1e9) / 1e6, (double)compress_ns / objects,
+               (double)parsed_size / compressed.size, compressed.size, parsed_size, (double)buffer->size / compressed.size);
+        bench_print_counters(counters, compress_values, objects);
+        printf("%-18s %10.2f GB/s %10.2f Mobj/s %8.2f ns/obj", decode_name, parsed_size / (decompress_ns / 1e9) / 1e9, objects / (decompress_ns / 1e9) / 1e6, (double)decompress_ns / objects);
+        bench_print_counters(counters, decompress_values, objects);
+
+        FastOsuParser__CompressedFree(&compressed);
+        FastOsuParser__Free(&beatmap);
+
+}
+
+// Drops "path" from the page cache, so the next read comes from storage (it has to be written back already)
+void bench_evict(const char* path) {
+#if defined(__linux__)
+        int fd = open(path, O_RDONLY);
+        if (fd == -1) return;
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+#else
+        (void)path;
+#endif
+}
+
+// Best of "reps" batch parses of "paths" with "options", printed as one line (returns its time, ns)
+uint64_t bench_batch_run(const char* name, char** paths, size_t files, FastOsuParser__Beatmap* beatmaps, const FastOsuParser__BatchOptions* options, int b_cold, size_t total_size, size_t objects, int reps) {
+
+        uint64_t best_ns = UINT64_MAX;
+        for (int rep = 0; rep < reps; rep++) {
+                if (b_cold) for (size_t f = 0; f < files; f++) bench_evict(paths[f]);
+                memset(beatmaps, 0, files * sizeof(FastOsuParser__Beatmap));
+                uint64_t start = bench_now();
+                FastOsuParser__ParseBatch((const char**)paths, files, beatmaps, NULL, options);
+                uint64_t elapsed = bench_now() - start;
+                for (size_t f = 0; f < files; f++) FastOsuParser__Free(&beatmaps[f]);
+                if (elapsed < best_ns) best_ns = elapsed;
+        }
+
+        if (best_ns == 0) best_ns = 1;
+        printf("%-18s %10.1f MB/s %10.2f Mobj/s %8.2f ns/obj %8.0f files/s\n", name, total_size / (best_ns / 1e9) / 1e6, objects / (best_ns / 1e9) / 1e6, (double)best_ns / objects, files / (best_ns / 1e9));
+
+        return best_ns;
+
+}
+
+// Writes "files" generated beatmaps to "directory" & parses them as one batch (cold: evicted from the page cache before each run, io_uring: again with it, to compare)
+// (skip duplicates: every other file is a copy of the one before, & the batch runs again skipping them, to compare)
+void bench_batch(const BenchSettings* settings, const char* directory, size_t files, int threads, int b_io_uring, int b_skip_duplicates, int b_cold, int reps) {
+
+        char** paths = calloc(files, sizeof(char*));
+        FastOsuParser__Beatmap* beatmaps = calloc(files, sizeof(FastOsuParser__Beatmap));
+        size_t total_size = 0;
+        for (size_t f = 0; f < files; f++) {
+                BenchBuffer buffer = bench_generate(settings, (int)(b_skip_duplicates ? f/2 : f));
+                paths[f] = malloc(strlen(directory) + 32);
+                sprintf(paths[f], "%s/bench_%zu.osu", directory, f);
+                FILE* file = fopen(paths[f], "wb");
+                if (file == NULL || fwrite(buffer.data, 1, buffer.size, file) != buffer.size) {
+                        fprintf(stderr, "can't write %s\n", paths[f]);
+                        exit(1);
+                }
+#if defined(__linux__)
+                if (b_cold) { // (dirty pages can't be evicted)
+                        fflush(file);
+                        fsync(fileno(file));
+                }
+#endif
+                fclose(file);
+                total_size += buffer.size;
+                free(buffer.data);
+        }
+
+        FastOsuParser__BatchOptions options;
+        memset(&options, 0, sizeof(options));
+        options.threads = threads;
+
+        size_t objects = files * settings->objects;
+        if (b_cold) printf("(batch files dropped from the page cache before every run)\n");
+        uint64_t sync_ns = bench_batch_run("batch", paths, files, beatmaps, &options, b_cold, total_size, objects, reps);
+        if (b_io_uring) {
+                options.b_io_uring = 1;
+                uint64_t io_uring_ns = bench_batch_run("batch io_uring", paths, files, beatmaps, &options, b_cold, total_size, objects, reps);
+                printf("io_uring over pread(): %.2fx files/s\n", (double)sync_ns / io_uring_ns);
+                options.b_io_uring = 0;
+        }
+        if (b_skip_duplicates) {
+                options.b_skip_duplicates = 1;
+                uint64_t skip_ns = bench_batch_run("batch skip dups", paths, files, beatmaps, &options, b_cold, total_size, objects, reps);
+                printf("skipping duplicates (half of the files): %.2fx files/s\n", (double)sync_ns / skip_ns);
+        }
+
+        for (size_t f = 0; f < files; f++) {
+                remove(paths[f]);
+                free(paths[f]);
+        }
+        free(paths);
+        free(beatmaps);
+
+}
+
+// The reference parser has to agree with FastOsuParser on what it found (else the comparison means nothing)
+int bench_check(const BenchBuffer* buffer) {
+
+        FastOsuParser__Beatmap beatmap;
+        memset(&beatmap, 0, sizeof(beatmap));
+        BenchReference reference;
+        FastOsuParser__Error error = FastOsuParser__ParseBufferPadded(buffer->data, buffer->size, &beatmap);
+        bench_reference_parse(buffer->data, buffer->size, &reference);
+
+        size_t curve_points_count = 0;
+        int b_same = (error == FastOsuParser__SUCCESS && reference.hit_objects_count == beatmap.hit_objects_count && reference.timing_points_count == beatmap.timing_points_count);
+        for (size_t ho = 0; b_same && ho < beatmap.hit_objects_count; ho++) {
+                const FastOsuParser__HitObject* hit_object = &beatmap.hit_objects[ho];
+                if (hit_object->time != reference.hit_objects_time[ho]) b_same = 0;
+                if (!(hit_object->type & 2)) continue;
+                for (size_t cp = 0; b_same && cp < hit_object->object_params.curve_points_count; cp++, curve_points_count++) {
+                        if (curve_points_count >= reference.curve_points_count ||
+                            hit_object->object_params.curve_points[cp].x != reference.curve_points[curve_points_count].x ||
+                            hit_object->object_params.curve_points[cp].y != reference.curve_points[curve_points_count].y) b_same = 0;
+                }
+        }
+        if (curve_points_count != reference.curve_points_count) b_same = 0;
+
+        FastOsuParser__Free(&beatmap);
+        bench_reference_free(&reference);
+
+        return b_same;
+
+}
+
+void bench_usage() {
+        printf(
+                "Usage: fastosuparser_bench [options]\n"
+                "  --objects N              Hit objects per beatmap (default 20000)\n"
+                "  --slider-ratio R         Share of sliders, 0-1 (default 0.5)\n"
+                "  --curve-points N         Per slider (default 3)\n"
+                "  --timing-points-every N  Hit objects per timing point (default 50)\n"
+                "  --seed S                 Generator seed (default 1)\n"
+                "  --reps N                 Runs per benchmark, the best one counts (default 20)\n"
+                "  --batch-files N          Files for the batch benchmark, 0 = skip it (default 64)\n"
+                "  --batch-dir DIR          Where to write them (default .)\n"
+                "  --threads N              Batch threads, 0 = one per CPU core (default 0)\n"
+                "  --io-uring               Also run the batch with io_uring (Linux 5.6+), & compare the files/s against pread()\n"
+                "  --skip-duplicates        Make every other batch file a copy, & also run the batch skipping them, to compare\n"
+                "  --cold                   Drop the batch files from the page cache before every batch run (cold storage)\n"
+                "  --compare                Also run the reference parser, & compare the speed against it\n"
+                "  --write FILE             Only write the generated beatmap to FILE\n"
+        );
+}
+
+int main(int argc, char** argv) {
+
+        BenchSettings settings = { 20000, 0.5, 3, 50, 1 };
+        int reps = 20;
+        size_t batch_files = 64;
+        const char* batch_directory = ".";
+        int threads = 0;
+        int b_io_uring = 0;
+        int b_skip_duplicates = 0;
+        int b_cold = 0;
+        int b_compare = 0;
+        const char* write_path = NULL;
+
+        for (int a = 1; a < argc; a++) {
+                const char* value = (a+1 < argc) ? argv[a+1] : NULL;
+                if (strcmp(argv[a], "--compare") == 0) b_compare = 1;
+                else if (strcmp(argv[a], "--io-uring") == 0) b_io_uring = 1;
+                else if (strcmp(argv[a], "--skip-duplicates") == 0) b_skip_duplicates = 1;
+                else if (strcmp(argv[a], "--cold") == 0) b_cold = 1;
+                else if (value == NULL) {
+                        bench_usage();
+                        return strcmp(argv[a], "--help") != 0;
+                }
+                else if (strcmp(argv[a], "--objects") == 0) settings.objects = strtoull(value, NULL, 10), a++;
+                else if (strcmp(argv[a], "--slider-ratio") == 0) settings.slider_ratio = strtod(value, NULL), a++;
+                else if (strcmp(argv[a], "--curve-points") == 0) settings.curve_points = atoi(value), a++;
+                else if (strcmp(argv[a], "--timing-points-every") == 0) settings.timing_points_every = atoi(value), a++;
+                else if (strcmp(argv[a], "--seed") == 0) settings.seed = strtoull(value, NULL, 10), a++;
+                else if (strcmp(argv[a], "--reps") == 0) reps = atoi(value), a++;
+                else if (strcmp(argv[a], "--batch-files") == 0) batch_files = strtoull(value, NULL, 10), a++;
+                else if (strcmp(argv[a], "--batch-dir") == 0) batch_directory = value, a++;
+                else if (strcmp(argv[a], "--threads") == 0) threads = atoi(value), a++;
+                else if (strcmp(argv[a], "--write") == 0) write_path = value, a++;
+                else {
+                        bench_usage();
+                        return 1;
+                }
+        }
+        if (reps < 1) reps = 1;
+
+        BenchBuffer buffer = bench_generate(&settings, 0);
+        if (write_path != NULL) {
+                FILE* file = fopen(write_path, "wb");
+                if (file == NULL || fwrite(buffer.data, 1, buffer.size, file) != buffer.size) return 1;
+                return fclose(file) != 0;
+        }
+
+        printf("%zu objects, %.0f%% sliders x %d curve points, a timing point every %d objects, seed %llu: %zu bytes\n",
+               settings.objects, settings.slider_ratio * 100, settings.curve_points, settings.timing_points_every, (unsigned long long)settings.seed, buffer.size);
+
+        BenchCounters counters;
+        bench_counters_open(&counters);
+        if (counters.fds[0] == -1) printf("(no hardware counters: perf_event_open() unavailable or not permitted)\n");
+
+        uint64_t parse_ns = bench_run("parse", BENCH_FULL, &buffer, settings.objects, reps, &counters);
+        bench_run("parse columns", BENCH_COLUMNS, &buffer, settings.objects, reps, &counters);
+        bench_run("parse no curves", BENCH_NO_CURVE_POINTS, &buffer, settings.objects, reps, &counters);
+        bench_run("metadata only", BENCH_METADATA, &buffer, settings.objects, reps, &counters);
+        bench_run("stream 64 KiB", BENCH_STREAM, &buffer, settings.objects, reps, &counters);
+        bench_run("range 10 s", BENCH_RANGE, &buffer, settings.objects, reps, &counters);
+
+        // Slider-dense variant (every object a long slider), where curve point decoding dominates
+        BenchSettings slider_settings = settings;
+        slider_settings.slider_ratio = 1;
+        slider_settings.curve_points = (settings.curve_points < 16) ? 16 : settings.curve_points;
+        BenchBuffer slider_buffer = bench_generate(&slider_settings, 0);
+        uint64_t slider_parse_ns = bench_run("parse slider-dense", BENCH_FULL, &slider_buffer, settings.objects, reps, &counters);
+
+        // Slider paths (flattening the curves & where each slider ends), which parsing doesn't do
+        bench_paths("slider paths", &buffer, reps, &counters);
+        bench_paths("paths slider-dense", &slider_buffer, reps, &counters);
+
+        // Compressed in-memory copies (FastOsuParser__Compress()/FastOsuParser__Decompress())
+        bench_compress("compress", "decode", &buffer, reps, &counters);
+        bench_compress("compress dense", "decode dense", &slider_buffer, reps, &counters);
+
+        if (b_compare) {
+                if (!bench_check(&buffer) || !bench_check(&slider_buffer)) {
+                        fprintf(stderr, "the reference parser disagrees with FastOsuParser\n");
+                        return 1;
+                }
+                uint64_t reference_ns = bench_run("reference", BENCH_REFERENCE, &buffer, settings.objects, reps, &counters);
+                uint64_t slider_reference_ns = bench_run("ref slider-dense", BENCH_REFERENCE, &slider_buffer, settings.objects, reps, &counters);
+                printf("speedup over the reference: %.2fx, %.2fx slider-dense\n", (double)reference_ns / parse_ns, (double)slider_reference_ns / slider_parse_ns);
+        }
+
+        bench_counters_close(&counters);
+        free(buffer.data);
+        free(slider_buffer.data);
+
+        if (batch_files != 0) bench_batch(&settings, batch_directory, batch_files, threads, b_io_uring, b_skip_duplicates, b_cold, (reps < 5) ? reps : 5);
+
+        return 0;
+
+}
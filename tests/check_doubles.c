@@ -0,0 +1,178 @@
+// Checks FastOsuParser's number decoder against strtod() in the "C" locale: bit-identical values, ending at the same character
+// for every line of the corpus (tests/doubles.txt), random numbers & exact halfway points, then again under a comma-decimal locale
+// Build from the repository root: cc -O2 -I. tests/check_doubles.c -o check_doubles -lm -pthread
+// Run: ./check_doubles tests/doubles.txt [random numbers, default 1000000]
+
+#include "FastOsuParser.h"
+
+#include <locale.h>
+
+
+
+typedef struct {
+        size_t checked;
+        size_t failed;
+} CheckCounts;
+
+// splitmix64
+uint64_t check_random(uint64_t* state) {
+
+        uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+        return z ^ (z >> 31);
+
+}
+
+// Parses "text" both ways & compares (strtod() has to run in the "C" locale, "expected"/"expected_size" are used instead if given)
+void check_number(const char* text, const double* expected, const size_t* expected_size, CheckCounts* counts) {
+
+        double reference;
+        size_t reference_size;
+        if (expected != NULL) {
+                reference = *expected;
+                reference_size = *expected_size;
+        }
+        else {
+                char* reference_end;
+                reference = strtod(text, &reference_end);
+                reference_size = reference_end - text;
+        }
+
+        const char* i = text;
+        double value = _FastOsuParser__ParseDouble(&i);
+
+        counts->checked++;
+        if (memcmp(&value, &reference, sizeof(value)) != 0 || (size_t)(i - text) != reference_size) {
+                if (counts->failed++ < 20) printf("MISMATCH \"%.80s%s\": %.17g (%zu chars) vs strtod %.17g (%zu chars)\n", text, (strlen(text) > 80) ? "..." : "", value, (size_t)(i - text), reference, reference_size);
+        }
+
+}
+
+// A random finite double (uniform over the bit patterns)
+double check_random_double(uint64_t* state) {
+        for (;;) {
+                uint64_t bits = check_random(state);
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                if (isfinite(value)) return value;
+        }
+}
+
+int main(int argc, char** argv) {
+
+        if (argc < 2) {
+                fprintf(stderr, "usage: %s tests/doubles.txt [random numbers]\n", argv[0]);
+                return 2;
+        }
+        size_t random_count = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1000000;
+
+        setlocale(LC_ALL, "C");
+
+        // Corpus
+        FILE* file = fopen(argv[1], "rb");
+        if (file == NULL) {
+                fprintf(stderr, "can't open %s\n", argv[1]);
+                return 2;
+        }
+
+        size_t lines_count = 0;
+        size_t lines_capacity = 1024;
+        char** lines = malloc(lines_capacity * sizeof(char*));
+        char line[4096];
+        while (fgets(line, sizeof(line), file) != NULL) {
+                line[strcspn(line, "\r\n")] = '\0';
+                if (line[0] == '\0' || line[0] == '#') continue;
+                if (lines_count == lines_capacity) lines = realloc(lines, (lines_capacity *= 2) * sizeof(char*));
+                lines[lines_count++] = strdup(line);
+        }
+        fclose(file);
+
+        CheckCounts corpus = { 0, 0 };
+        double* references = malloc(lines_count * sizeof(double));
+        size_t* reference_sizes = malloc(lines_count * sizeof(size_t));
+        for (size_t n = 0; n < lines_count; n++) {
+                char* reference_end;
+                references[n] = strtod(lines[n], &reference_end);
+                reference_sizes[n] = reference_end - lines[n];
+                check_number(lines[n], NULL, NULL, &corpus);
+        }
+        printf("corpus: %zu numbers, %zu mismatches\n", corpus.checked, corpus.failed);
+
+        // Random numbers: shortest & shorter forms of random doubles, random digit strings & exponents
+        CheckCounts random = { 0, 0 };
+        uint64_t state = 0x5EED;
+        char text[2048];
+        for (size_t n = 0; n < random_count; n++) {
+                double value = check_random_double(&state);
+                snprintf(text, sizeof(text), "%.*g", 1 + (int)(check_random(&state) % 17), value);
+                check_number(text, NULL, NULL, &random);
+
+                int digits = 1 + (int)(check_random(&state) % 40);
+                int point = (int)(check_random(&state) % (digits + 1));
+                size_t size = 0;
+                for (int d = 0; d < digits; d++) {
+                        if (d == point && point != 0) text[size++] = '.';
+                        text[size++] = '0' + (char)(check_random(&state) % 10);
+                }
+                if (check_random(&state) % 2) size += snprintf(text + size, sizeof(text) - size, "e%d", (int)(check_random(&state) % 700) - 350);
+                text[size] = '\0';
+                check_number(text, NULL, NULL, &random);
+        }
+        printf("random: %zu numbers, %zu mismatches\n", random.checked, random.failed);
+
+        // Exactly halfway between two neighbouring doubles (must round to even), & just above/below that
+        CheckCounts halfway = { 0, 0 };
+#if LDBL_MANT_DIG >= 64
+        for (size_t n = 0; n < random_count / 20; n++) {
+                double value = fabs(check_random_double(&state));
+                if (n % 4 == 0) value = ldexp(value, -1000 - (int)(check_random(&state) % 100)); // (some subnormals)
+                double next = nextafter(value, HUGE_VAL);
+                if (!isfinite(next)) continue;
+
+                snprintf(text, sizeof(text), "%.800Le", ((long double)value + (long double)next) / 2); // (exact, both fit in a long double's 64 bits)
+                check_number(text, NULL, NULL, &halfway);
+
+                char* exponent = strchr(text, 'e');
+                char exponent_text[16];
+                snprintf(exponent_text, sizeof(exponent_text), "%s", exponent);
+                char* last = exponent - 1;
+                while (*last == '0') last--;
+                snprintf(last + 1, sizeof(text) - (last + 1 - text), "1%s", exponent_text);
+                check_number(text, NULL, NULL, &halfway);
+
+                int digits = 17 + (int)(check_random(&state) % 10);
+                snprintf(text + 2 + digits, sizeof(text) - 2 - digits, "%s", exponent_text);
+                check_number(text, NULL, NULL, &halfway);
+        }
+        printf("halfway: %zu numbers, %zu mismatches\n", halfway.checked, halfway.failed);
+#else
+        printf("halfway: skipped (long double can't hold them exactly)\n");
+#endif
+
+        // Again with a comma decimal point, against the "C" locale's results
+        const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "fr_FR.utf8", "de_DE", "fr_FR", "German", "French" };
+        CheckCounts localized = { 0, 0 };
+        const char* locale = NULL;
+        for (size_t n = 0; n < sizeof(locales)/sizeof(locales[0]) && locale == NULL; n++) {
+                if (setlocale(LC_ALL, locales[n]) != NULL && localeconv()->decimal_point[0] == ',') locale = locales[n];
+        }
+        if (locale != NULL) {
+                for (size_t n = 0; n < lines_count; n++) check_number(lines[n], &references[n], &reference_sizes[n], &localized);
+                printf("corpus under %s: %zu numbers, %zu mismatches\n", locale, localized.checked, localized.failed);
+                setlocale(LC_ALL, "C");
+        }
+        else printf("corpus under a comma locale: skipped (none installed)\n");
+
+        for (size_t n = 0; n < lines_count; n++) free(lines[n]);
+        free(lines);
+        free(references);
+        free(reference_sizes);
+
+        size_t failed = corpus.failed + random.failed + halfway.failed + localized.failed;
+        printf("%s\n", (failed == 0) ? "OK" : "FAILED");
+
+        return (failed == 0) ? 0 : 1;
+
+}
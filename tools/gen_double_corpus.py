@@ -0,0 +1,86 @@
+#!/usr/bin/env python3
+# Prints tests/doubles.txt: decimals the way osu! writes them in real maps ([TimingPoints] beat lengths, slider lengths,
+# [Difficulty]/[General] values), then hand-picked hard cases for correctly rounded parsing
+# Usage: python3 tools/gen_double_corpus.py > tests/doubles.txt
+
+import struct
+
+
+def float32(value):
+        return struct.unpack("f", struct.pack("f", value))[0]
+
+
+def main():
+        lines = []
+        seen = set()
+
+        def add(text):
+                if text not in seen:
+                        seen.add(text)
+                        lines.append(text)
+
+        lines.append("# Generated by tools/gen_double_corpus.py, checked by tests/check_doubles.c")
+
+        # Uninherited beat lengths (60000/BPM), as osu!stable (15 significant digits) & osu!lazer (round-trip) write them
+        lines.append("# [TimingPoints] beat lengths")
+        for quarter_bpm in range(4*30, 4*400 + 1):
+                beat_length = 60000 / (quarter_bpm / 4)
+                add("%.15g" % beat_length)
+                add(repr(beat_length))
+        for milli_bpm in range(170000, 180001, 7):
+                add("%.15g" % (60000000 / milli_bpm))
+
+        # Inherited beat lengths (-100/slider velocity multiplier), written from doubles & from floats
+        lines.append("# [TimingPoints] inherited beat lengths")
+        for hundredths in range(1, 1001):
+                multiplier = hundredths / 100
+                add("%.15g" % (-100 / multiplier))
+                add("%.15g" % (-100 / float32(multiplier)))
+                add(repr(-100 / multiplier))
+
+        # Slider lengths: pixels from a float slider multiplier, ticks of 1/8 beat
+        lines.append("# [HitObjects] slider lengths")
+        for tenths in range(4, 37):
+                slider_multiplier = float32(tenths / 10)
+                for eighths in range(1, 129):
+                        pixels = slider_multiplier * 100 * (eighths / 8)
+                        add("%.15g" % float32(pixels))
+                        add("%.15g" % pixels)
+
+        # [Difficulty] & [General] values, from decimal strings & from floats
+        lines.append("# [Difficulty] & [General]")
+        for tenths in range(0, 101):
+                add("%g" % (tenths / 10))
+                add("%.15g" % float32(tenths / 10))
+        for hundredths in range(0, 1001, 3):
+                add("%g" % (hundredths / 100))
+                add("%.15g" % float32(hundredths / 100))
+
+        # Hard cases: boundaries, halfway points, subnormals, long & odd forms
+        lines.append("# Hard cases")
+        for text in [
+                "0", "-0", "+0", "0.0", "-0.0", "00000.00000", ".5", "5.", "-.5", "+1.5", "1e0", "1E+0", "1e-0", "0e999999",
+                "9007199254740992", "9007199254740993", "9007199254740994", "9007199254740995", "18014398509481985",
+                "9223372036854775807", "9223372036854775808", "18446744073709551615", "18446744073709551616", "99999999999999999999",
+                "1e22", "1e23", "1e-22", "1e-23", "8.5e22", "4.9e-324", "5e-324", "2.4703282292062327e-324", "2.4703282292062328e-324",
+                "2.2250738585072011e-308", "2.2250738585072012e-308", "2.2250738585072014e-308", "1.7976931348623157e308",
+                "1.7976931348623158e308", "1.7976931348623159e308", "1e308", "1e309", "1e-400", "1e400", "-1e400",
+                "0.1", "0.2", "0.3", "0.30000000000000004", "123456789012345678901234567890", "0.000000000000000000000000000001",
+                "3.141592653589793238462643383279502884197169399375105820974944592307816406286", "2.718281828459045235360287471352662497757",
+                "7.2057594037927933e16", "1448997445238699", "4.4501477170144023e-308", "6.631236846766476e-316", "3.2378839133029012e15",
+                "0.500000000000000166533453693773481063544750213623046875", "0.500000000000000166533453693773481063544750213623046876",
+                "0.500000000000000166533453693773481063544750213623046874", "1.00000000000000011102230246251565404236316680908203125",
+                "1.00000000000000011102230246251565404236316680908203124", "1.00000000000000011102230246251565404236316680908203126",
+                "9007199254740993.0000000000000000000000000000000000000000000000000000000000000000000000000000000000001",
+                "179769313486231580793728971405303415079934132710037826936173778980444968292764750946649017977587207096330286416692887910946555547851940402630657488671505820681908902000708383676273854845817711531764475730270069855571366959622842914819860834936475292719074168444365510704342711559699508093042880177904174497791.9999999999",
+                "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000024703282292062328",
+                "1" + "0" * 400 + "e-400", "1" + "0" * 900 + "e-900", "0." + "0" * 900 + "1e901", "1." + "0" * 850 + "1",
+                "9" * 850, "9" * 850 + "e-850", "0." + "9" * 850, "-123.456e-5", "1e-5", "1e-6", "1e-7", "12.5e+3",
+        ]:
+                add(text)
+
+        print("\n".join(lines))
+
+
+if __name__ == "__main__":
+        main()
@@ -0,0 +1,78 @@
+#!/usr/bin/env python3
+# Prints _FastOsuParser__KEY_SLOTS for FastOsuParser.h: the perfect hash of _FastOsuParser__KEY_NAMES under _FastOsuParser__KeyHash(),
+# both read from the header, so that adding a key is editing the enum & the names, then pasting this script's output
+# If two keys share a slot, it looks for a new multiplier (the first random odd one, seeded, that gives every key its own slot) & prints it too
+# --check only compares it with the header's table (exits with 1 if it's stale or two keys collide)
+# Usage: python3 tools/gen_key_slots.py [--check] [FastOsuParser.h]
+
+import os
+import random
+import re
+import sys
+
+SLOT_BITS = 7
+
+
+def key_hash(key, multiplier):
+        x = ord(key[0]) | ord(key[1]) << 8 | ord(key[-1]) << 16 | len(key) << 24 # (every key has at least 2 letters)
+        return ((x * multiplier) & 0xFFFFFFFF) >> (32 - SLOT_BITS)
+
+
+def slots_of(keys, multiplier):
+        slots = [0] * (1 << SLOT_BITS)
+        for n, key in enumerate(keys, 1): # (0 is _FastOsuParser__KEY_UNKNOWN)
+                slot = key_hash(key, multiplier)
+                if slots[slot] != 0:
+                        return None
+                slots[slot] = n
+        return slots
+
+
+def find_multiplier(keys):
+        rng = random.Random(1)
+        while True:
+                multiplier = rng.getrandbits(32) | 1
+                if slots_of(keys, multiplier) is not None:
+                        return multiplier
+
+
+def main():
+        args = sys.argv[1:]
+        b_check = "--check" in args
+        args = [arg for arg in args if arg != "--check"]
+        path = args[0] if args else os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "FastOsuParser.h")
+        with open(path, encoding="utf-8") as file:
+                header = file.read()
+
+        names = re.search(r"_FastOsuParser__KEY_NAMES\[_FastOsuParser__KEYS_COUNT\]\[32\] = \{[^\n]*\n(.*?)\n\};", header, re.S)
+        keys = re.findall(r'"([^"]*)"', names.group(1))[1:] # (without the "" of _FastOsuParser__KEY_UNKNOWN)
+        multiplier = int(re.search(r"\(x \* (0x[0-9A-Fa-f]+)u\) >> %d" % (32 - SLOT_BITS), header).group(1), 16)
+        assert len(keys) < 256 and all(2 <= len(key) < 32 for key in keys)
+
+        slots = slots_of(keys, multiplier)
+        if b_check:
+                table = re.search(r"_FastOsuParser__KEY_SLOTS\[%d\] = \{(.*?)\};" % (1 << SLOT_BITS), header, re.S)
+                if slots is None:
+                        print("two keys share a slot with multiplier 0x%08X, regenerate the table" % multiplier)
+                        return 1
+                if [int(value) for value in re.findall(r"\d+", table.group(1))] != slots:
+                        print("_FastOsuParser__KEY_SLOTS doesn't match _FastOsuParser__KEY_NAMES, regenerate it")
+                        return 1
+                print("OK: %d keys, each in its own slot" % len(keys))
+                return 0
+
+        if slots is None:
+                multiplier = find_multiplier(keys)
+                slots = slots_of(keys, multiplier)
+                print("// (new multiplier for _FastOsuParser__KeyHash(): 0x%08Xu)" % multiplier)
+
+        print("// Key in each slot of the perfect hash (generated from _FastOsuParser__KEY_NAMES with _FastOsuParser__KeyHash() by tools/gen_key_slots.py, no two keys share a slot)")
+        print("static const unsigned char _FastOsuParser__KEY_SLOTS[%d] = {" % (1 << SLOT_BITS))
+        for n in range(0, len(slots), 16):
+                print("        " + ", ".join(str(slot) for slot in slots[n:n+16]) + ("," if n + 16 < len(slots) else ""))
+        print("};")
+        return 0
+
+
+if __name__ == "__main__":
+        sys.exit(main())
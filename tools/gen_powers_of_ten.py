@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+# Prints _FastOsuParser__POWERS_OF_TEN_128 for FastOsuParser.h: the top 128 bits of 10^-348..10^347, rounded down
+# (normalized so the highest bit is set, as Eisel-Lemire expects them)
+# Usage: python3 tools/gen_powers_of_ten.py
+
+MIN_EXPONENT = -348
+MAX_EXPONENT = 347
+
+
+def mantissa_128(exponent):
+        if exponent >= 0:
+                power = 10 ** exponent
+                bits = power.bit_length()
+                return power << (128 - bits) if bits <= 128 else power >> (bits - 128)
+
+        power = 10 ** -exponent
+        return (1 << (power.bit_length() + 127)) // power # (10^n isn't a power of 2, so this is below 2^128)
+
+
+def main():
+        entries = []
+        for exponent in range(MIN_EXPONENT, MAX_EXPONENT + 1):
+                mantissa = mantissa_128(exponent)
+                assert (1 << 127) <= mantissa < (1 << 128)
+                entries.append("{ 0x%016XULL, 0x%016XULL }" % (mantissa >> 64, mantissa & (2**64 - 1)))
+
+        print("// 10^%d..10^%d as { high 64 bits, low 64 bits } (generated by tools/gen_powers_of_ten.py)" % (MIN_EXPONENT, MAX_EXPONENT))
+        print("static const uint64_t _FastOsuParser__POWERS_OF_TEN_128[][2] = {")
+        for n in range(0, len(entries), 2):
+                print("        " + ", ".join(entries[n:n+2]) + ("," if n + 2 < len(entries) else ""))
+        print("};")
+
+
+if __name__ == "__main__":
+        main()